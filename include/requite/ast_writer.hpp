@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <requite/source_line_table.hpp>
+#include <requite/source_location.hpp>
+
 #include <llvm/ADT/Twine.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include <cstddef>
 #include <functional>
-#include <string>
 
 namespace requite {
 
@@ -16,11 +19,19 @@ struct Module;
 struct Context;
 struct Expression;
 
+// Writes an ast as intermediate requite source straight to the output file.
+// The tree is walked without recursion, and the location comments are looked
+// up in a line table of the module's source that is built once, so writing
+// takes bounded memory and time linear in the size of the ast.
 struct AstWriter final {
-  std::string _buffer;
-  llvm::raw_string_ostream _ostream;
+  using Self = requite::AstWriter;
+
+  static constexpr std::size_t OUTPUT_BUFFER_SIZE = 256 * 1024;
+
   std::reference_wrapper<Context> _context_ref;
-  unsigned _indentation;
+  llvm::raw_ostream *_ostream_ptr = nullptr;
+  requite::SourceLineTable _line_table = {};
+  unsigned _indentation = 0;
 
   // write_ast.cpp
   AstWriter(requite::Context &context);
@@ -29,29 +40,19 @@ struct AstWriter final {
   [[nodiscard]]
   const requite::Context &getContext() const;
   [[nodiscard]]
-  llvm::raw_string_ostream &getOstream();
+  llvm::raw_ostream &getOstream();
   [[nodiscard]] bool writeAst(const requite::Module &module,
                               llvm::StringRef out_path);
+  void writeAst(const requite::Module &module, llvm::raw_ostream &ostream);
   void writeIndentation();
   void addIndentation();
   void removeIndentation();
-  void writeExpression(const requite::Expression &expression);
+  void writeExpressions(const requite::Expression &first);
+  [[nodiscard]] bool
+  writeExpressionHead(const requite::Expression &expression);
   void writeExpressionLocationComment(const requite::Expression &expression);
+  [[nodiscard]] requite::SourceLocation
+  getSourceLocation(const char *text_ptr);
 };
 
-struct AstWriterIndentLock final {
-  using Self = requite::AstWriterIndentLock;
-
-  std::reference_wrapper<requite::AstWriter> _writer;
-
-  // write_ast.cpp
-  AstWriterIndentLock(AstWriter &writer);
-  AstWriterIndentLock(const Self &) = delete;
-  AstWriterIndentLock(Self &&) = delete;
-  ~AstWriterIndentLock();
-
-  Self &operator=(const Self &) = delete;
-  Self &operator=(Self &&) = delete;
-};
-
-} // namespace requite
\ No newline at end of file
+} // namespace requite
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <requite/opcode.hpp>
+
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+namespace requite {
+
+struct Expression;
+
+// The binary ast format stores an expression tree as a flat array of fixed
+// size nodes that link to each other by index, followed by side tables for
+// the module's source text, literal text and integer words. Every section is
+// 8 byte aligned and stored in host byte order, so a mapped file is read in
+// place without parsing.
+//
+// layout: header | identifier | source text | nodes | text | integer words
+
+static constexpr std::array<char, 8> BINARY_AST_MAGIC = {'R', 'Q', 'A', 'S',
+                                                         'T', 'B', 'I', 'N'};
+static constexpr std::uint32_t BINARY_AST_VERSION = 1;
+static constexpr llvm::StringLiteral BINARY_AST_EXTENSION = ".rqast";
+static constexpr std::uint32_t BINARY_AST_BYTE_ORDER = 0x01020304;
+static constexpr std::uint32_t BINARY_AST_NO_INDEX =
+    std::numeric_limits<std::uint32_t>::max();
+
+enum class BinaryAstPayload : std::uint8_t { NONE, TEXT, INTEGER };
+
+struct BinaryAstHeader final {
+  std::array<char, 8> _magic;
+  std::uint32_t _version;
+  std::uint32_t _byte_order;
+  std::uint32_t _root_i;
+  std::uint32_t _node_count;
+  std::uint64_t _identifier_offset;
+  std::uint64_t _identifier_size;
+  std::uint64_t _source_offset;
+  std::uint64_t _source_size;
+  std::uint64_t _node_offset;
+  std::uint64_t _text_offset;
+  std::uint64_t _text_size;
+  std::uint64_t _word_offset;
+  std::uint64_t _word_count;
+};
+
+// Source and payload locations are offsets into the source text and into the
+// text or word table. An integer payload stores its bit width as its length
+// and its signedness in the flags.
+struct BinaryAstNode final {
+  std::uint16_t _opcode;
+  requite::BinaryAstPayload _payload;
+  std::uint8_t _flags;
+  std::uint32_t _next_i;
+  std::uint32_t _branch_i;
+  std::uint32_t _source_offset;
+  std::uint32_t _source_length;
+  std::uint32_t _payload_offset;
+  std::uint32_t _payload_length;
+};
+
+static constexpr std::uint8_t BINARY_AST_FLAG_UNSIGNED = 1 << 0;
+
+static_assert(requite::OPCODE_COUNT <=
+              std::numeric_limits<std::uint16_t>::max());
+static_assert(sizeof(requite::BinaryAstHeader) % 8 == 0);
+static_assert(sizeof(requite::BinaryAstNode) == 28);
+
+// An expression tree read from a binary ast. The expressions are allocated in
+// one array, and their source and literal text refer to the data they were
+// read from, which must outlive them. The expressions are marked as being in
+// the array, so Expression::deleteExpression leaves them to the array's owner
+// and passes can still splice and delete them one at a time.
+struct BinaryAst final {
+  using Self = requite::BinaryAst;
+
+  std::unique_ptr<requite::Expression[]> _expressions_uptr;
+  requite::Expression *_root_ptr = nullptr;
+  llvm::StringRef _identifier = {};
+  llvm::StringRef _source_text = {};
+
+  // binary_ast.cpp
+  BinaryAst();
+  BinaryAst(const Self &) = delete;
+  BinaryAst(Self &&);
+  ~BinaryAst();
+  Self &operator=(const Self &) = delete;
+  Self &operator=(Self &&);
+  [[nodiscard]] bool read(llvm::StringRef data);
+  [[nodiscard]] bool getHasExpression() const;
+  [[nodiscard]] requite::Expression &getExpression();
+  [[nodiscard]] const requite::Expression &getExpression() const;
+  [[nodiscard]] llvm::StringRef getIdentifier() const;
+  [[nodiscard]] llvm::StringRef getSourceText() const;
+};
+
+// binary_ast.cpp
+void writeBinaryAst(const requite::Expression *first,
+                    llvm::StringRef identifier, llvm::StringRef source_text,
+                    llvm::raw_ostream &ostream);
+
+} // namespace requite
@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace requite {
+
+// The binary token format is a header followed by one fixed size record per
+// token, in host byte order. Source offsets are relative to the start of the
+// module's source text.
+
+static constexpr std::array<char, 8> BINARY_TOKENS_MAGIC = {
+    'R', 'Q', 'T', 'O', 'K', 'B', 'I', 'N'};
+static constexpr std::uint32_t BINARY_TOKENS_VERSION = 1;
+static constexpr std::uint32_t BINARY_TOKENS_BYTE_ORDER = 0x01020304;
+
+struct BinaryTokensHeader final {
+  std::array<char, 8> _magic;
+  std::uint32_t _version;
+  std::uint32_t _byte_order;
+  std::uint64_t _token_count;
+};
+
+struct BinaryToken final {
+  std::uint32_t _line;
+  std::uint32_t _column;
+  std::uint32_t _source_offset;
+  std::uint32_t _source_length;
+  std::uint16_t _type;
+  std::uint8_t _spacing;
+  std::uint8_t _reserved;
+};
+
+static_assert(sizeof(requite::BinaryTokensHeader) == 24);
+static_assert(sizeof(requite::BinaryToken) == 20);
+
+} // namespace requite
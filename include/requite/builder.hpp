@@ -2,7 +2,9 @@
 
 #include <requite/symbol.hpp>
 #include <requite/temporary.hpp>
+#include <requite/type_interner.hpp>
 
+#include <llvm/ADT/DenseMap.h>
 #include <llvm/IR/Value.h>
 
 #include <functional>
@@ -34,6 +36,7 @@ struct Builder final {
   llvm::BasicBlock *_current_llvm_block_ptr = nullptr;
   requite::Scope *_current_scope_ptr = nullptr;
   std::vector<requite::Temporary> _temporary_list = {};
+  llvm::DenseMap<const requite::Symbol *, llvm::Type *> _llvm_type_map;
 
   // builder.cpp
   Builder(requite::Context &context);
@@ -94,6 +97,7 @@ struct Builder final {
   [[nodiscard]] bool buildStatement_Local(requite::Expression &statement);
 
   [[nodiscard]] llvm::Type* makeLlvmType(const requite::Symbol& type);
+  [[nodiscard]] llvm::Type *getLlvmType(requite::TypeHandle type);
   void buildAssignment(llvm::Value* llvm_value, llvm::AllocaInst* llvm_alloca);
   [[nodiscard]] llvm::AllocaInst* buildLlvmAlloca(llvm::Type* llvm_type, llvm::StringRef name);
   [[nodiscard]] llvm::Value *buildValue(requite::Expression &expression,
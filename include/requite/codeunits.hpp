@@ -6,6 +6,9 @@
 
 #include <llvm/ADT/StringRef.h>
 
+#include <cstdint>
+#include <optional>
+
 namespace requite {
 
 [[nodiscard]] constexpr llvm::StringRef getUtf8Name(char codeunit);
@@ -7,6 +7,7 @@
 #include <requite/alias.hpp>
 #include <requite/anonymous_function.hpp>
 #include <requite/assert.hpp>
+#include <requite/diagnostics.hpp>
 #include <requite/file.hpp>
 #include <requite/label.hpp>
 #include <requite/log_type.hpp>
@@ -14,14 +15,19 @@
 #include <requite/named_procedure_group.hpp>
 #include <requite/node.hpp>
 #include <requite/object.hpp>
+#include <requite/object_cache.hpp>
 #include <requite/opcode.hpp>
 #include <requite/ordered_variable.hpp>
+#include <requite/pool.hpp>
 #include <requite/procedure.hpp>
 #include <requite/scope.hpp>
 #include <requite/situation.hpp>
 #include <requite/table.hpp>
+#include <requite/type_interner.hpp>
 #include <requite/unordered_variable.hpp>
 
+#include <llvm/ADT/APFloat.h>
+#include <llvm/ADT/APSInt.h>
 #include <llvm/ADT/ArrayRef.h>
 #include <llvm/ADT/SmallString.h>
 #include <llvm/ADT/StringMap.h>
@@ -37,6 +43,7 @@
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/Target/TargetOptions.h>
 
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -45,6 +52,7 @@
 namespace requite {
 
 struct File;
+struct Fingerprint;
 struct Options;
 struct Expression;
 struct Token;
@@ -52,6 +60,31 @@ struct SourceLocation;
 struct SourceRange;
 struct Value;
 
+// The symbols made by one thread. Only the owning thread makes values in its
+// pools, so making a symbol does not take a lock, and every value still lives
+// as long as the context that owns the pools.
+struct SymbolPools final {
+  using Self = requite::SymbolPools;
+
+  requite::Pool<requite::Scope> _scope_pool = {};
+  requite::Pool<requite::Table> _table_pool = {};
+  requite::Pool<requite::Object> _object_pool = {};
+  requite::Pool<requite::NamedProcedureGroup> _named_procedure_group_pool = {};
+  requite::Pool<requite::Procedure> _procedure_pool = {};
+  requite::Pool<requite::Alias> _alias_pool = {};
+  requite::Pool<requite::UnorderedVariable> _unordered_variable_pool = {};
+  requite::Pool<requite::OrderedVariable> _ordered_variable_pool = {};
+  requite::Pool<requite::AnonymousFunction> _anonymous_function_pool = {};
+  requite::Pool<requite::Label> _label_pool = {};
+
+  SymbolPools() = default;
+  SymbolPools(const Self &) = delete;
+  SymbolPools(Self &&) = delete;
+  ~SymbolPools() = default;
+  Self &operator=(const Self &) = delete;
+  Self &operator=(Self &&) = delete;
+};
+
 // llvm context is in inherited type to ensure that the llvm context is
 // destroyed last.
 struct _ContextLlvmContext {
@@ -61,26 +94,15 @@ struct _ContextLlvmContext {
 struct Context final : public requite::_ContextLlvmContext {
   std::string _executable_path;
   llvm::SourceMgr _source_mgr = {};
-  mutable std::mutex _mutex = {};
+  requite::Diagnostics _diagnostics = {};
   std::unique_ptr<llvm::ThreadPoolInterface> _scheduler_ptr = {};
   llvm::StringMap<requite::Opcode> _opcode_table = {};
   std::vector<std::unique_ptr<requite::Module>> _module_uptrs = {};
   requite::Module _source_module = {};
   requite::ExportTable _base_export_table = {};
-  std::vector<std::unique_ptr<requite::Scope>> _scope_uptrs = {};
-  std::vector<std::unique_ptr<requite::Table>> _table_uptrs = {};
-  std::vector<std::unique_ptr<requite::Object>> _object_uptrs = {};
-  std::vector<std::unique_ptr<requite::NamedProcedureGroup>>
-      _named_procedure_group_uptrs = {};
-  std::vector<std::unique_ptr<requite::Procedure>> _procedure_uptrs = {};
-  std::vector<std::unique_ptr<requite::Alias>> _alias_uptrs = {};
-  std::vector<std::unique_ptr<requite::UnorderedVariable>>
-      _unordered_variable_uptrs = {};
-  std::vector<std::unique_ptr<requite::OrderedVariable>>
-      _ordered_variable_uptrs = {};
-  std::vector<std::unique_ptr<requite::AnonymousFunction>>
-      _anonymous_function_uptrs = {};
-  std::vector<std::unique_ptr<requite::Label>> _label_uptrs = {};
+  std::uint64_t _symbol_pools_id;
+  std::mutex _symbol_pools_mutex = {};
+  std::vector<std::unique_ptr<requite::SymbolPools>> _symbol_pools_uptrs = {};
   llvm::StringMap<requite::Module *> _module_map = {};
   std::string _target_triple = {};
   llvm::TargetOptions _llvm_options = {};
@@ -89,6 +111,8 @@ struct Context final : public requite::_ContextLlvmContext {
   std::unique_ptr<llvm::DataLayout> _llvm_data_layout_uptr = {};
   std::unique_ptr<llvm::IRBuilder<>> _llvm_builder_uptr = {};
   std::unique_ptr<llvm::Module> _llvm_module_uptr = nullptr;
+  requite::ObjectCache _object_cache = {};
+  requite::TypeInterner _type_interner = {};
 
   // context.cpp
   Context(std::string &&executable_path);
@@ -106,42 +130,7 @@ struct Context final : public requite::_ContextLlvmContext {
   [[nodiscard]] requite::UnorderedVariable &makeUnorderedVariable();
   [[nodiscard]] requite::AnonymousFunction &makeAnonymousFunction();
   [[nodiscard]] requite::Label &makeLabel();
-  [[nodiscard]] std::vector<std::unique_ptr<requite::Scope>> &getScopeUptrs();
-  [[nodiscard]] const std::vector<std::unique_ptr<requite::Scope>> &
-  getScopeUptrs() const;
-  [[nodiscard]] std::vector<std::unique_ptr<requite::Table>> &getTableUptrs();
-  [[nodiscard]] const std::vector<std::unique_ptr<requite::Table>> &
-  getTableUptrs() const;
-  [[nodiscard]] std::vector<std::unique_ptr<requite::Object>> &getObjectUptrs();
-  [[nodiscard]] const std::vector<std::unique_ptr<requite::Object>> &
-  getObjectUptrs() const;
-  [[nodiscard]] std::vector<std::unique_ptr<requite::NamedProcedureGroup>> &
-  getNamedProcedureGroupUptrs();
-  [[nodiscard]] const std::vector<
-      std::unique_ptr<requite::NamedProcedureGroup>> &
-  getNamedProcedureGroupUptrs() const;
-  [[nodiscard]] std::vector<std::unique_ptr<requite::Procedure>> &
-  getProcedureUptrs();
-  [[nodiscard]] const std::vector<std::unique_ptr<requite::Procedure>> &
-  getProcedureUptrs() const;
-  [[nodiscard]] std::vector<std::unique_ptr<requite::Alias>> &getAliasUptrs();
-  [[nodiscard]] const std::vector<std::unique_ptr<requite::Alias>> &
-  getAliasUptrs() const;
-  [[nodiscard]] std::vector<std::unique_ptr<requite::OrderedVariable>> &
-  getOrderedVariableUptrs();
-  [[nodiscard]] const std::vector<std::unique_ptr<requite::OrderedVariable>> &
-  getOrderedVariableUptrs() const;
-  [[nodiscard]] std::vector<std::unique_ptr<requite::UnorderedVariable>> &
-  getUnorderedVariableUptrs();
-  [[nodiscard]] const std::vector<std::unique_ptr<requite::UnorderedVariable>> &
-  getUnorderedVariableUptrs() const;
-  [[nodiscard]] std::vector<std::unique_ptr<requite::AnonymousFunction>> &
-  getAnonymousFunctionUptrs();
-  [[nodiscard]] const std::vector<std::unique_ptr<requite::AnonymousFunction>> &
-  getAnonymousFunctionUptrs() const;
-  [[nodiscard]] std::vector<std::unique_ptr<requite::Label>> &getLabelUptrs();
-  [[nodiscard]] const std::vector<std::unique_ptr<requite::Label>> &
-  getLabelUptrs() const;
+  [[nodiscard]] requite::SymbolPools &getThreadSymbolPools();
 
   // file.cpp
   [[nodiscard]]
@@ -168,6 +157,19 @@ struct Context final : public requite::_ContextLlvmContext {
   [[nodiscard]]
   const std::vector<std::unique_ptr<requite::Module>> &getModuleUptrs() const;
 
+  // fingerprint.cpp
+  [[nodiscard]]
+  bool readFingerprint(requite::Fingerprint &out_fingerprint,
+                       llvm::StringRef fingerprint_path);
+  void fingerprintModuleInput(requite::Module &module);
+  [[nodiscard]]
+  bool getIsModuleUpToDate(requite::Module &module,
+                           llvm::StringRef output_path);
+  void removeModuleFingerprint(llvm::StringRef output_path);
+  [[nodiscard]]
+  bool writeModuleFingerprint(requite::Module &module,
+                              llvm::StringRef output_path);
+
   // validate_source.cpp
   [[nodiscard]]
   bool validateSourceFileText(requite::File &file);
@@ -175,6 +177,8 @@ struct Context final : public requite::_ContextLlvmContext {
   // situate_ast.cpp
   [[nodiscard]]
   bool situateAst(requite::Module &module);
+  [[nodiscard]]
+  bool situateAndTabulateAst(requite::Module &module);
 
   // tokenize_tokens.cpp
   [[nodiscard]]
@@ -193,8 +197,13 @@ struct Context final : public requite::_ContextLlvmContext {
   [[nodiscard]] bool checkEntryPointCount();
 
   // tabulate.cpp
+  [[nodiscard]] bool tabulateModuleStatement(requite::Module &module,
+                                             requite::Expression &statement);
   [[nodiscard]] bool tabulateEntryPoint(requite::Module &module,
                                         requite::Expression &expression);
+  [[nodiscard]] bool tabulateProcedure(requite::Module &module,
+                                       requite::Procedure &procedure);
+  [[nodiscard]] bool tabulateProcedures(requite::Module &module);
   [[nodiscard]] bool tabulateLocal(requite::Module &module,
                                    requite::Scope &scope,
                                    requite::Expression &expression);
@@ -203,6 +212,7 @@ struct Context final : public requite::_ContextLlvmContext {
                         requite::Expression &first_statement);
 
   // prototype.cpp
+  [[nodiscard]] bool prototypeProcedures(requite::Module &module);
   [[nodiscard]] bool prototypeEntryPoint(requite::Procedure &procedure);
   [[nodiscard]] bool prototypeLocal(requite::Scope &scope,
                                     requite::OrderedVariable &variable);
@@ -225,10 +235,16 @@ struct Context final : public requite::_ContextLlvmContext {
   inferenceTypeOfValue(requite::Symbol &out_symbol, requite::Scope &scope,
                        requite::Expression &value_expression);
   [[nodiscard]] bool
-  inferenceTypeOfNaryValue(requite::Symbol &out_symbol, requite::Scope& scope, requite::Expression& first);
-  [[nodiscard]] bool resolveTypeAttributes(requite::AttributeFlags flags,
+  inferenceTypeOfValue(requite::TypeHandle &out_type, requite::Scope &scope,
+                       requite::Expression &value_expression);
+  [[nodiscard]] bool
+  inferenceTypeOfNaryValue(requite::TypeHandle &out_type, requite::Scope& scope, requite::Expression& first);
+  [[nodiscard]] bool resolveTypeAttributes(requite::AttributeFlags &flags,
                                            requite::Expression &first);
 
+  // type_interner.cpp
+  [[nodiscard]] requite::TypeHandle internType(const requite::Symbol &symbol);
+
   // choose_overload.cpp
   [[nodiscard]] bool chooseOverload(requite::Scope &scope,
                                     requite::Expression &call_expression);
@@ -239,6 +255,20 @@ struct Context final : public requite::_ContextLlvmContext {
   [[nodiscard]] bool
   evaluateConstantUnsigned(unsigned &out_unsigned, requite::Scope &scope,
                            requite::Expression &value_expression);
+  [[nodiscard]] bool
+  evaluateConstantInteger(llvm::APSInt &out_integer, requite::Scope &scope,
+                          requite::Expression &value_expression);
+  [[nodiscard]] bool
+  evaluateConstantIntegerLiteral(llvm::APSInt &out_integer,
+                                 requite::Expression &literal_expression);
+  [[nodiscard]] bool evaluateConstantReal(llvm::APFloat &out_real,
+                                          requite::Scope &scope,
+                                          requite::Expression &value_expression);
+  [[nodiscard]] bool
+  evaluateConstantComparison(llvm::APSInt &out_integer, requite::Scope &scope,
+                             requite::Expression &comparison_expression);
+  void foldConstantValue(requite::Scope &scope,
+                         requite::Expression &value_expression);
   [[nodiscard]] requite::Value
   evaluateValue(requite::Scope &scope, requite::Expression &value_expression,
                 const requite::Symbol &type);
@@ -247,11 +277,20 @@ struct Context final : public requite::_ContextLlvmContext {
   [[nodiscard]] bool writeTokens(requite::Module &module,
                                  std::vector<requite::Token> &tokens,
                                  llvm::StringRef output_path);
+  [[nodiscard]] bool writeBinaryTokens(requite::Module &module,
+                                       std::vector<requite::Token> &tokens,
+                                       llvm::StringRef output_path);
 
   // write_ast.cpp
   [[nodiscard]] bool writeAst(const requite::Module &module,
                               llvm::StringRef output_path);
 
+  // binary_ast.cpp
+  [[nodiscard]] bool writeBinaryAst(const requite::Module &module,
+                                    llvm::StringRef output_path);
+  [[nodiscard]] bool readBinaryAst(requite::Module &module,
+                                   llvm::StringRef path);
+
   // write_user_symbols.cpp
   [[nodiscard]] bool writeUserSymbols(llvm::StringRef output_path);
 
@@ -263,6 +302,12 @@ struct Context final : public requite::_ContextLlvmContext {
 
   // write_object.cpp
   [[nodiscard]] bool writeObject(llvm::StringRef output_path);
+  [[nodiscard]] bool emitObject(llvm::raw_pwrite_stream &ostream,
+                                llvm::StringRef output_path);
+  void initializeObjectCache();
+  [[nodiscard]] requite::ObjectCache &getObjectCache();
+  [[nodiscard]] const requite::ObjectCache &getObjectCache() const;
+  void logObjectCacheStats();
 
   // get_module.cpp
   [[nodiscard]]
@@ -334,6 +379,7 @@ struct Context final : public requite::_ContextLlvmContext {
 
   // run.cpp
   [[nodiscard]] bool run();
+  [[nodiscard]] bool runPasses();
 
   // opcode.cpp
   [[nodiscard]]
@@ -342,24 +388,34 @@ struct Context final : public requite::_ContextLlvmContext {
 
   // tasks.cpp
   void startScheduler();
+  [[nodiscard]] bool getHasScheduler() const;
   void waitForTasks();
 
   // detail/tasks.inl
   template <typename TaskPram> void scheduleTask(TaskPram &&task);
 
   // log.cpp
-  void logMessage(llvm::Twine message);
-  void logInputFileMessage(requite::LogType type, llvm::Twine message);
-  void logSourceMessage(llvm::Twine filename, requite::LogType type,
-                        llvm::Twine message);
-  void logSourceMessage(const requite::Token &token, requite::LogType type,
-                        llvm::Twine message,
-                        llvm::ArrayRef<llvm::SMRange> ranges = {},
-                        llvm::ArrayRef<llvm::SMFixIt> fixits = {});
-  void logSourceMessage(const requite::Expression &expression,
-                        requite::LogType type, llvm::Twine message,
-                        llvm::ArrayRef<llvm::SMRange> ranges = {},
-                        llvm::ArrayRef<llvm::SMFixIt> fixits = {});
+  [[nodiscard]] requite::Diagnostics &getDiagnostics();
+  [[nodiscard]] const requite::Diagnostics &getDiagnostics() const;
+  [[nodiscard]] bool getIsErrorLimitReached() const;
+  void renderDiagnostics();
+  // every diagnostic is logged with a stable id, which machine readable
+  // output reports as its rule.
+  void logMessage(requite::LogType type, llvm::StringRef id,
+                  llvm::Twine message);
+  void logInputFileMessage(requite::LogType type, llvm::StringRef id,
+                           llvm::Twine message);
+  void logIdentifiedSourceMessage(llvm::Twine filename, requite::LogType type,
+                                  llvm::StringRef id, llvm::Twine message);
+  void logIdentifiedSourceMessage(
+      const requite::Token &token, requite::LogType type, llvm::StringRef id,
+      llvm::Twine message, llvm::ArrayRef<llvm::SMRange> ranges = {},
+      llvm::ArrayRef<llvm::SMFixIt> fixits = {});
+  void logIdentifiedSourceMessage(
+      const requite::Expression &expression, requite::LogType type,
+      llvm::StringRef id, llvm::Twine message,
+      llvm::ArrayRef<llvm::SMRange> ranges = {},
+      llvm::ArrayRef<llvm::SMFixIt> fixits = {});
   void logErrorNonInstantEvaluatableName(requite::Expression &expression);
   void logErrorNonExternallyAccessableTable(requite::Expression &expression);
   void logErrorAlreadySymbolOfName(requite::Expression &expression);
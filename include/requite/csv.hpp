@@ -4,16 +4,18 @@
 
 #pragma once
 
-#include <llvm/ADT/SmallString.h>
 #include <llvm/ADT/StringRef.h>
+#include <llvm/Support/raw_ostream.h>
 
 namespace requite {
 
-template <unsigned SMALL_SIZE_PARAM>
-[[nodiscard]]
-llvm::StringRef getCsvValueText(llvm::SmallString<SMALL_SIZE_PARAM> &buffer,
-                                llvm::StringRef text);
+// Whether any character in the text must be escaped in a csv value.
+[[nodiscard]] inline bool getHasCsvEscapes(llvm::StringRef text);
 
-}
+// Writes the text as a quoted csv value, escaping characters as needed.
+inline void writeCsvValueText(llvm::raw_ostream &ostream,
+                              llvm::StringRef text);
 
-#include <requite/detail/csv.hpp>
\ No newline at end of file
+} // namespace requite
+
+#include <requite/detail/csv.hpp>
@@ -4,40 +4,80 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+
 namespace requite {
 
-template <unsigned SMALL_SIZE_PARAM>
-llvm::StringRef getCsvValueText(llvm::SmallString<SMALL_SIZE_PARAM> &buffer,
-                                llvm::StringRef text) {
-  buffer.clear();
-  std::size_t buffer_size = 0;
-  buffer += "\" ";
-  for (const char c : text) {
-    switch (c) {
-    case '\"':
-      buffer.append("\"\"");
-      break;
-    case '\t':
-      buffer.append("\\t");
-      break;
-    case '\v':
-      buffer.append("\\v");
-      break;
-    case '\n':
-      buffer.append("\\v");
-      break;
-    case '\r':
-      buffer.append("\\r");
-      break;
-    case '\\':
-      buffer.append("\\\\");
-      break;
-    default:
-      buffer += c;
+// The letter that follows the escape for each character, or zero if the
+// character is written as is.
+static constexpr std::array<char, 256> CSV_ESCAPES = [] {
+  std::array<char, 256> escapes = {};
+  escapes[static_cast<unsigned char>('\"')] = '\"';
+  escapes[static_cast<unsigned char>('\t')] = 't';
+  escapes[static_cast<unsigned char>('\v')] = 'v';
+  escapes[static_cast<unsigned char>('\n')] = 'v';
+  escapes[static_cast<unsigned char>('\r')] = 'r';
+  escapes[static_cast<unsigned char>('\\')] = '\\';
+  return escapes;
+}();
+
+[[nodiscard]] inline bool getHasCsvEscapes(llvm::StringRef text) {
+  // Eight characters are tested at a time for a quote, a backslash or a
+  // control character. A control character that needs no escape only sends
+  // the word on to the exact check below.
+  static constexpr std::uint64_t ONES = 0x0101010101010101;
+  static constexpr std::uint64_t HIGHS = 0x8080808080808080;
+  const char *ptr = text.begin();
+  const char *const end = text.end();
+  for (; end - ptr >= 8; ptr += 8) {
+    std::uint64_t word;
+    std::memcpy(&word, ptr, sizeof(word));
+    const std::uint64_t quotes = word ^ (ONES * '\"');
+    const std::uint64_t backslashes = word ^ (ONES * '\\');
+    const std::uint64_t candidates =
+        ((quotes - ONES) & ~quotes) | ((backslashes - ONES) & ~backslashes) |
+        ((word - ONES * 0x20) & ~word);
+    if ((candidates & HIGHS) == 0) {
+      continue;
+    }
+    for (unsigned char_i = 0; char_i < 8; ++char_i) {
+      if (requite::CSV_ESCAPES[static_cast<unsigned char>(ptr[char_i])] != 0) {
+        return true;
+      }
+    }
+  }
+  for (; ptr != end; ++ptr) {
+    if (requite::CSV_ESCAPES[static_cast<unsigned char>(*ptr)] != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline void writeCsvValueText(llvm::raw_ostream &ostream,
+                              llvm::StringRef text) {
+  ostream << "\" ";
+  if (!requite::getHasCsvEscapes(text)) {
+    ostream << text;
+    ostream << " \"";
+    return;
+  }
+  // Runs of characters that need no escape are written in one piece.
+  const char *run_ptr = text.begin();
+  for (const char *ptr = text.begin(); ptr != text.end(); ++ptr) {
+    const char escape = requite::CSV_ESCAPES[static_cast<unsigned char>(*ptr)];
+    if (escape == 0) {
+      continue;
     }
+    ostream.write(run_ptr, ptr - run_ptr);
+    const char escaped[2] = {escape == '\"' ? '\"' : '\\', escape};
+    ostream.write(escaped, 2);
+    run_ptr = ptr + 1;
   }
-  buffer += " \"";
-  return buffer;
+  ostream.write(run_ptr, text.end() - run_ptr);
+  ostream << " \"";
 }
 
-} // namespace requite
\ No newline at end of file
+} // namespace requite
@@ -6,12 +6,7 @@ namespace requite {
 
 inline bool ExportTable::getHasExportSymbolOfName(llvm::StringRef name) const {
   REQUITE_ASSERT(!name.empty());
-  llvm::StringMapConstIterator<requite::RootSymbol> it =
-      this->getSymbolMap().find(name);
-  if (it != this->getSymbolMap().end()) {
-    return true;
-  }
-  return false;
+  return this->getSymbolMap().getHasName(requite::HashedName(name));
 }
 
 template <typename SymbolArg> void ExportTable::addExportSymbol(SymbolArg &symbol) {
@@ -19,9 +14,10 @@ template <typename SymbolArg> void ExportTable::addExportSymbol(SymbolArg &symbo
   REQUITE_ASSERT(!this->getHasExportSymbolOfName(symbol.getName()));
   REQUITE_ASSERT(!symbol.getHasContaining());
   symbol.setContaining(*this);
-  this->getSymbolMap().insert(
-      std::pair<llvm::StringRef, requite::RootSymbol>(
-          symbol.getName(), requite::RootSymbol::makeUser(symbol)));
+  const bool is_inserted = this->getSymbolMap().insert(
+      requite::HashedName(symbol.getName()),
+      requite::RootSymbol::makeUser(symbol));
+  REQUITE_ASSERT(is_inserted);
 }
 
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 
 #include <requite/assert.hpp>
 
+#include <utility>
+
 namespace requite {
 
 inline void Expression::clear() {
@@ -15,6 +17,7 @@ inline void Expression::clear() {
   this->_source_text_ptr = nullptr;
   this->_source_text_length = 0;
   this->_data.emplace<std::monostate>();
+  this->_resolved_type = {};
 }
 
 bool Expression::getHasBranch() const { return this->_branch_ptr != nullptr; }
@@ -40,7 +43,7 @@ unsigned Expression::getBranchCount() const {
   unsigned count = 0;
   while (expression_ptr != nullptr) {
     ++count;
-    expression_ptr = expression_ptr->_branch_ptr;
+    expression_ptr = expression_ptr->_next_ptr;
   }
   return count;
 }
@@ -71,15 +74,10 @@ const requite::Expression *Expression::getBranchPtr() const {
 
 requite::Expression &Expression::getBranch(unsigned branch_i) {
   requite::Expression *expression_ptr = this->_branch_ptr;
-  unsigned count = 0;
-  while (expression_ptr != nullptr) {
-    ++count;
-    expression_ptr = expression_ptr->_next_ptr;
-    if (count == branch_i) {
-      return requite::getRef(expression_ptr);
-    }
+  for (; branch_i != 0; --branch_i) {
+    expression_ptr = requite::getRef(expression_ptr)._next_ptr;
   }
-  REQUITE_UNREACHABLE();
+  return requite::getRef(expression_ptr);
 }
 
 requite::Expression &Expression::getLastBranch() {
@@ -92,24 +90,20 @@ requite::Expression &Expression::getLastBranch() {
 }
 
 const requite::Expression &Expression::getLastBranch() const {
-  const requite::Expression *expression_ptr = this;
-  while (expression_ptr->_branch_ptr != nullptr) {
-    expression_ptr = expression_ptr->_branch_ptr;
+  REQUITE_ASSERT(this->getHasBranch());
+  const requite::Expression *expression_ptr = this->_branch_ptr;
+  while (expression_ptr->_next_ptr != nullptr) {
+    expression_ptr = expression_ptr->_next_ptr;
   }
   return requite::getRef(expression_ptr);
 }
 
 const requite::Expression &Expression::getBranch(unsigned branch_i) const {
   const requite::Expression *expression_ptr = this->_branch_ptr;
-  unsigned count = 0;
-  while (expression_ptr != nullptr) {
-    ++count;
-    expression_ptr = expression_ptr->_branch_ptr;
-    if (count == branch_i) {
-      return requite::getRef(expression_ptr);
-    }
+  for (; branch_i != 0; --branch_i) {
+    expression_ptr = requite::getRef(expression_ptr)._next_ptr;
   }
-  REQUITE_UNREACHABLE();
+  return requite::getRef(expression_ptr);
 }
 
 requite::Expression &Expression::getNext() {
@@ -128,28 +122,18 @@ const requite::Expression *Expression::getNextPtr() const {
 
 requite::Expression &Expression::getNext(unsigned next_i) {
   requite::Expression *expression_ptr = this->_next_ptr;
-  unsigned count = 0;
-  while (expression_ptr != nullptr) {
-    ++count;
-    expression_ptr = expression_ptr->_next_ptr;
-    if (count == next_i) {
-      return requite::getRef(expression_ptr);
-    }
+  for (; next_i != 0; --next_i) {
+    expression_ptr = requite::getRef(expression_ptr)._next_ptr;
   }
-  REQUITE_UNREACHABLE();
+  return requite::getRef(expression_ptr);
 }
 
 const requite::Expression &Expression::getNext(unsigned next_i) const {
   const requite::Expression *expression_ptr = this->_next_ptr;
-  unsigned count = 0;
-  while (expression_ptr != nullptr) {
-    ++count;
-    expression_ptr = expression_ptr->_next_ptr;
-    if (count == next_i) {
-      return requite::getRef(expression_ptr);
-    }
+  for (; next_i != 0; --next_i) {
+    expression_ptr = requite::getRef(expression_ptr)._next_ptr;
   }
-  REQUITE_UNREACHABLE();
+  return requite::getRef(expression_ptr);
 }
 
 requite::Expression &Expression::getLastNext() {
@@ -259,14 +243,8 @@ void Expression::mergeBranch() {
     this->setNext(branch.popNext());
   }
   this->setSource(branch);
-  if (branch.getHasDataText()) {
-    if (this->getHasDataText()) {
-      this->changeDataText(branch.getDataText());
-    } else {
-      this->setDataText(branch.getDataText());
-    }
-  }
-  delete &branch;
+  this->_data = std::move(branch._data);
+  requite::Expression::deleteExpression(branch);
 }
 
 inline void
@@ -290,6 +268,7 @@ Expression::replaceWithRecursiveCopy(requite::Expression &replacement) {
   this->changeOpcode(replacement.getOpcode());
   this->setSource(replacement);
   this->setDataText(replacement.getDataText());
+  this->_resolved_type = {};
 }
 
 } // namespace requite
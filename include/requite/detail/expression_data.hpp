@@ -9,11 +9,16 @@ namespace requite {
 inline void Expression::clearData() { this->_data.emplace<std::monostate>(); }
 
 inline bool Expression::getHasDataText() const {
-  return std::holds_alternative<std::string>(this->_data);
+  return std::holds_alternative<std::string>(this->_data) ||
+         std::holds_alternative<llvm::StringRef>(this->_data);
 }
 
 inline llvm::StringRef Expression::getDataText() const {
   REQUITE_ASSERT(requite::getHasTextData(this->getOpcode()));
+  if (const llvm::StringRef *text_ptr =
+          std::get_if<llvm::StringRef>(&this->_data)) {
+    return *text_ptr;
+  }
   return llvm::StringRef(std::get<std::string>(this->_data));
 }
 
@@ -25,7 +30,7 @@ inline void Expression::setDataText(llvm::StringRef text) {
 inline void Expression::changeDataText(llvm::StringRef text) {
   REQUITE_ASSERT(requite::getHasTextData(this->getOpcode()));
   REQUITE_ASSERT(this->getHasDataText());
-  std::get<std::string>(this->_data).assign(text.str());
+  this->_data.emplace<std::string>(text.str());
 }
 
 inline bool Expression::getHasScope() const {
@@ -237,4 +242,19 @@ inline const llvm::APSInt &Expression::getInteger() const {
   return std::get<llvm::APSInt>(this->_data);
 }
 
+inline bool Expression::getHasResolvedType() const {
+  return !this->_resolved_type.getIsNone();
+}
+
+inline requite::TypeHandle Expression::getResolvedType() const {
+  REQUITE_ASSERT(this->getHasResolvedType());
+  return this->_resolved_type;
+}
+
+inline void Expression::setResolvedType(requite::TypeHandle type) {
+  REQUITE_ASSERT(!type.getIsNone());
+  REQUITE_ASSERT(!this->getHasResolvedType());
+  this->_resolved_type = type;
+}
+
 } // namespace requite
\ No newline at end of file
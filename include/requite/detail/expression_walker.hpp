@@ -6,7 +6,6 @@
 
 #include <requite/assert.hpp>
 #include <requite/expression.hpp>
-#include <requite/unreachable.hpp>
 
 namespace requite {
 
@@ -43,8 +42,9 @@ requite::ExpressionWalkResult ExpressionWalker::getResult() const {
   return result;
 }
 
-requite::ExpressionWalker &ExpressionWalker::doOne(
-    std::function<void(requite::Expression &branch)> predicate) {
+template <requite::ExpressionVisitor PredicateParam>
+requite::ExpressionWalker &
+ExpressionWalker::doOne(PredicateParam &&predicate) {
   if (!this->getHasExpression()) {
     return *this;
   }
@@ -54,9 +54,9 @@ requite::ExpressionWalker &ExpressionWalker::doOne(
   return *this;
 }
 
-requite::ExpressionWalker &ExpressionWalker::doOne(
-    std::function<void(unsigned branch_i, requite::Expression &branch)>
-        predicate) {
+template <requite::IndexedExpressionVisitor PredicateParam>
+requite::ExpressionWalker &
+ExpressionWalker::doOne(PredicateParam &&predicate) {
   if (!this->getHasExpression()) {
     return *this;
   }
@@ -66,9 +66,8 @@ requite::ExpressionWalker &ExpressionWalker::doOne(
   return *this;
 }
 
-inline bool ExpressionWalker::tryOne(
-    std::function<bool(unsigned branch_i, requite::Expression &branch)>
-        predicate) {
+template <requite::IndexedExpressionPredicate PredicateParam>
+bool ExpressionWalker::tryOne(PredicateParam &&predicate) {
   if (!this->getHasExpression()) {
     return false;
   }
@@ -78,8 +77,8 @@ inline bool ExpressionWalker::tryOne(
   return result;
 }
 
-inline bool ExpressionWalker::tryOne(
-    std::function<bool(requite::Expression &branch)> predicate) {
+template <requite::ExpressionPredicate PredicateParam>
+bool ExpressionWalker::tryOne(PredicateParam &&predicate) {
   if (!this->getHasExpression()) {
     return false;
   }
@@ -89,75 +88,66 @@ inline bool ExpressionWalker::tryOne(
   return result;
 }
 
-template <unsigned COUNT_PARAM>
-requite::ExpressionWalker &ExpressionWalker::doSome(
-    std::function<void(requite::Expression &branch)> predicate) {
-  if constexpr (COUNT_PARAM == 0) {
-    return *this;
-  } else {
-    if (!this->getHasExpression()) {
-      return *this;
-    }
-    constexpr unsigned NEXT_COUNT = COUNT_PARAM - 1;
+template <unsigned COUNT_PARAM, requite::ExpressionVisitor PredicateParam>
+requite::ExpressionWalker &
+ExpressionWalker::doSome(PredicateParam &&predicate) {
+  for (unsigned some_i = 0; some_i < COUNT_PARAM && this->getHasExpression();
+       ++some_i) {
     this->doOne(predicate);
-    return this->doSome<NEXT_COUNT>(predicate);
   }
-  REQUITE_UNREACHABLE();
+  return *this;
 }
 
-template <unsigned COUNT_PARAM>
-requite::ExpressionWalker &ExpressionWalker::doSome(
-    std::function<void(unsigned branch_i, requite::Expression &branch)>
-        predicate) {
-  if constexpr (COUNT_PARAM == 0) {
-    return *this;
-  } else {
-    if (!this->getHasExpression()) {
-      return *this;
-    }
-    constexpr unsigned NEXT_COUNT = COUNT_PARAM - 1;
+template <unsigned COUNT_PARAM,
+          requite::IndexedExpressionVisitor PredicateParam>
+requite::ExpressionWalker &
+ExpressionWalker::doSome(PredicateParam &&predicate) {
+  for (unsigned some_i = 0; some_i < COUNT_PARAM && this->getHasExpression();
+       ++some_i) {
     this->doOne(predicate);
-    return this->doSome<NEXT_COUNT>(predicate);
   }
-  REQUITE_UNREACHABLE();
+  return *this;
 }
 
-requite::ExpressionWalkResult ExpressionWalker::doAll(
-    std::function<void(requite::Expression &branch)> predicate) {
+template <requite::ExpressionVisitor PredicateParam>
+requite::ExpressionWalkResult
+ExpressionWalker::doAll(PredicateParam &&predicate) {
   while (this->getHasExpression()) {
     this->doOne(predicate);
   }
   return this->getResult();
 }
 
-requite::ExpressionWalkResult ExpressionWalker::doAll(
-    std::function<void(unsigned branch_i, requite::Expression &branch)>
-        predicate) {
+template <requite::IndexedExpressionVisitor PredicateParam>
+requite::ExpressionWalkResult
+ExpressionWalker::doAll(PredicateParam &&predicate) {
   while (this->getHasExpression()) {
     this->doOne(predicate);
   }
   return this->getResult();
 }
 
-requite::ExpressionWalker &ExpressionWalker::doUntilLast(
-    std::function<void(requite::Expression &branch)> predicate) {
+template <requite::ExpressionVisitor PredicateParam>
+requite::ExpressionWalker &
+ExpressionWalker::doUntilLast(PredicateParam &&predicate) {
   while (this->getHasExpression() && this->getExpression().getHasNext()) {
     this->doOne(predicate);
   }
   return *this;
 }
 
-requite::ExpressionWalker &ExpressionWalker::doUntilLast(
-    std::function<void(unsigned branch_i, requite::Expression &branch)>
-        predicate) {
+template <requite::IndexedExpressionVisitor PredicateParam>
+requite::ExpressionWalker &
+ExpressionWalker::doUntilLast(PredicateParam &&predicate) {
   while (this->getHasExpression() && this->getExpression().getHasNext()) {
     this->doOne(predicate);
   }
   return *this;
 }
 
-inline requite::ExpressionWalker &ExpressionWalker::doUntilLastOrCondition(
-    std::function<bool(requite::Expression &branch)> predicate) {
+template <requite::ExpressionPredicate PredicateParam>
+requite::ExpressionWalker &
+ExpressionWalker::doUntilLastOrCondition(PredicateParam &&predicate) {
   while (this->getHasExpression() && this->getExpression().getHasNext()) {
     const bool result = this->tryOne(predicate);
     if (result) {
@@ -167,9 +157,9 @@ inline requite::ExpressionWalker &ExpressionWalker::doUntilLastOrCondition(
   return *this;
 }
 
-inline requite::ExpressionWalker &ExpressionWalker::doUntilLastOrCondition(
-    std::function<bool(unsigned branch_i, requite::Expression &branch)>
-        predicate) {
+template <requite::IndexedExpressionPredicate PredicateParam>
+requite::ExpressionWalker &
+ExpressionWalker::doUntilLastOrCondition(PredicateParam &&predicate) {
   while (this->getHasExpression() && this->getExpression().getHasNext()) {
     const bool result = this->tryOne(predicate);
     if (result) {
@@ -179,17 +169,18 @@ inline requite::ExpressionWalker &ExpressionWalker::doUntilLastOrCondition(
   return *this;
 }
 
-requite::ExpressionWalkResult ExpressionWalker::doLast(
-    std::function<void(requite::Expression &branch)> predicate) {
+template <requite::ExpressionVisitor PredicateParam>
+requite::ExpressionWalkResult
+ExpressionWalker::doLast(PredicateParam &&predicate) {
   REQUITE_ASSERT(!this->getHasExpression() ||
                  !this->getExpression().getHasNext());
   this->doOne(predicate);
   return this->getResult();
 }
 
-requite::ExpressionWalkResult ExpressionWalker::doLast(
-    std::function<void(unsigned branch_i, requite::Expression &branch)>
-        predicate) {
+template <requite::IndexedExpressionVisitor PredicateParam>
+requite::ExpressionWalkResult
+ExpressionWalker::doLast(PredicateParam &&predicate) {
   REQUITE_ASSERT(!this->getHasExpression() ||
                  !this->getExpression().getHasNext());
   this->doOne(predicate);
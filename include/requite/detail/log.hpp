@@ -11,8 +11,8 @@ namespace requite {
 template <requite::Situation SITUATION_PARAM>
 void Context::logNotAtLeastBranchCount(requite::Expression &expression,
                                        unsigned count) {
-  this->logSourceMessage(
-      expression, requite::LogType::ERROR,
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "not-at-least-branch-count",
       llvm::Twine("expression with opcode \"") +
           requite::getName(expression.getOpcode()) + "\" in situation \"" +
           requite::getName<SITUATION_PARAM>() + "\" must have at least " +
@@ -22,8 +22,8 @@ void Context::logNotAtLeastBranchCount(requite::Expression &expression,
 template <requite::Situation SITUATION_PARAM>
 void Context::logNotExactBranchCount(requite::Expression &expression,
                                      unsigned count) {
-  this->logSourceMessage(
-      expression, requite::LogType::ERROR,
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "not-exact-branch-count",
       llvm::Twine("expression with opcode \"") +
           requite::getName(expression.getOpcode()) + "\" in situation \"" +
           requite::getName<SITUATION_PARAM>() + "\" must have exactly " +
@@ -33,8 +33,8 @@ void Context::logNotExactBranchCount(requite::Expression &expression,
 template <requite::Situation SITUATION_PARAM>
 void Context::logTooNotLessOrEqualToBranchCount(requite::Expression &expression,
                                                 unsigned count) {
-  this->logSourceMessage(
-      expression, requite::LogType::ERROR,
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "too-many-branches",
       llvm::Twine("expression with opcode \"") +
           requite::getName(expression.getOpcode()) + "\" in situation \"" +
           requite::getName<SITUATION_PARAM>() + "\" must have no more than " +
@@ -47,8 +47,8 @@ void Context::logInvalidBranchSituation(requite::Expression &branch,
                                         requite::Opcode branch_opcode,
                                         unsigned branch_i,
                                         llvm::Twine log_context) {
-  this->logSourceMessage(
-      branch, requite::LogType::ERROR,
+  this->logIdentifiedSourceMessage(
+      branch, requite::LogType::ERROR, "invalid-branch-situation",
       llvm::Twine("operation with opcode \"") + requite::getName(outer_opcode) +
           "\" has branch with opcode \"" + requite::getName(branch_opcode) +
           "\" at index " + llvm::Twine(branch_i) +
@@ -57,8 +57,9 @@ void Context::logInvalidBranchSituation(requite::Expression &branch,
 }
 
 void Context::logInvalidOperation(requite::Expression &expression) {
-  this->logSourceMessage(expression, requite::LogType::ERROR,
-                         "invalid operation.");
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "invalid-operation",
+      "invalid operation.");
 }
 
 } // namespace requite
\ No newline at end of file
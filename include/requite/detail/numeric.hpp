@@ -13,13 +13,17 @@
 #include <llvm/ADT/APSInt.h>
 #include <llvm/ADT/SmallString.h>
 #include <llvm/ADT/StringRef.h>
+#include <llvm/Support/MathExtras.h>
 
+#include <algorithm>
 #include <bit>
 #include <concepts>
+#include <cstdint>
 #include <limits>
 #include <stdfloat>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 namespace requite {
 
@@ -97,8 +101,100 @@ requite::NumericResult getNumericValue(llvm::StringRef text,
     return requite::NumericResult::OK;
   } else if constexpr (std::same_as<Numeric, llvm::APInt> ||
                        std::same_as<Numeric, llvm::APSInt>) {
-    // TODO
-
+    std::uint64_t base = 10;
+    llvm::StringRef digits_text = text;
+    const std::size_t base_end = text.find('x');
+    if (base_end != llvm::StringRef::npos) {
+      base = 0;
+      for (const char c : text.take_front(base_end)) {
+        if (c == '.') {
+          return requite::NumericResult::ERROR_INTEGER_WITH_DECIMAL_POINT;
+        } else if (c == '_') {
+          continue;
+        }
+        const std::uint64_t digit_base_multiplier =
+            requite::getDigitBaseMultiplier(c);
+        if (digit_base_multiplier >= 10) {
+          return requite::NumericResult::ERROR_INVALID_DIGIT;
+        }
+        base = base * 10 + digit_base_multiplier;
+        if (base > requite::MAX_BASE) {
+          return requite::NumericResult::ERROR_BASE_TOO_BIG;
+        }
+      }
+      if (base == 0) {
+        return requite::NumericResult::ERROR_ZERO_BASE;
+      }
+      digits_text = text.drop_front(base_end + 1);
+    }
+    // The digits are validated and counted first so that the accumulator can
+    // be sized once to hold any value with that many digits.
+    unsigned digit_count = 0;
+    for (const char c : digits_text) {
+      if (c == '.') {
+        return requite::NumericResult::ERROR_INTEGER_WITH_DECIMAL_POINT;
+      } else if (c == '_') {
+        continue;
+      }
+      char lower_c = c;
+      if (base < requite::MIN_UPPER_BASE) {
+        lower_c = requite::getLowercase(c);
+      }
+      if (requite::getDigitBaseMultiplier(lower_c) >= base) {
+        return requite::NumericResult::ERROR_INVALID_DIGIT;
+      }
+      ++digit_count;
+    }
+    if (digit_count == 0) {
+      return requite::NumericResult::ERROR_NO_DIGITS;
+    }
+    // Digits are accumulated into a machine word and only folded into the
+    // wide value once per chunk, which is as many digits as fit in a word
+    // (19 for decimal).
+    unsigned chunk_length = 0;
+    std::uint64_t chunk_multiplier = 1;
+    while (chunk_length < 64 &&
+           chunk_multiplier <= std::numeric_limits<std::uint64_t>::max() /
+                                   base) {
+      chunk_multiplier *= base;
+      ++chunk_length;
+    }
+    const unsigned depth_bound = std::max(
+        1u, digit_count * llvm::Log2_64_Ceil(std::max<std::uint64_t>(base, 2)));
+    llvm::APInt value(depth_bound, 0);
+    std::uint64_t chunk = 0;
+    unsigned chunk_i = 0;
+    for (const char c : digits_text) {
+      if (c == '_') {
+        continue;
+      }
+      char lower_c = c;
+      if (base < requite::MIN_UPPER_BASE) {
+        lower_c = requite::getLowercase(c);
+      }
+      chunk = chunk * base + requite::getDigitBaseMultiplier(lower_c);
+      if (++chunk_i == chunk_length) {
+        value *= chunk_multiplier;
+        value += chunk;
+        chunk = 0;
+        chunk_i = 0;
+      }
+    }
+    if (chunk_i != 0) {
+      std::uint64_t partial_multiplier = 1;
+      for (unsigned digit_i = 0; digit_i < chunk_i; ++digit_i) {
+        partial_multiplier *= base;
+      }
+      value *= partial_multiplier;
+      value += chunk;
+    }
+    value = value.trunc(std::max(1u, value.getActiveBits()));
+    if constexpr (std::same_as<Numeric, llvm::APSInt>) {
+      out_value = llvm::APSInt(std::move(value), true);
+    } else {
+      out_value = std::move(value);
+    }
+    return requite::NumericResult::OK;
   } else if constexpr (std::floating_point<Numeric>) {
     llvm::SmallString<16> clean_text;
     requite::NumericResult result = requite::cleanRealText(text, clean_text);
@@ -112,6 +208,58 @@ requite::NumericResult getNumericValue(llvm::StringRef text,
 inline requite::NumericResult
 getNumericValue(llvm::StringRef text, llvm::APFloat &out_value,
                 requite::FloatSemantics semantics) {
+  // The first 19 significant digits are gathered into a machine word with the
+  // decimal exponent, which is all the fast conversion needs. Only literals
+  // with more nonzero digits than that, or that the fast conversion can not
+  // round, are cleaned and handed to llvm::APFloat.
+  std::uint64_t significand = 0;
+  int exponent = 0;
+  unsigned significant_digit_count = 0;
+  bool found_digit = false;
+  bool found_decimal = false;
+  bool is_truncated = false;
+  for (const char c : text) {
+    if (c == '.') {
+      if (found_decimal) {
+        return requite::NumericResult::ERROR_MULTIPLE_DECIMAL_POINT;
+      }
+      found_decimal = true;
+      continue;
+    } else if (c == '_') {
+      continue;
+    } else if (c < '0' || c > '9') {
+      return requite::NumericResult::ERROR_INVALID_DIGIT;
+    }
+    found_digit = true;
+    const unsigned digit = static_cast<unsigned>(c - '0');
+    if (significand == 0 && digit == 0) {
+      if (found_decimal) {
+        --exponent;
+      }
+      continue;
+    }
+    if (significant_digit_count < 19) {
+      significand = significand * 10 + digit;
+      ++significant_digit_count;
+      if (found_decimal) {
+        --exponent;
+      }
+    } else {
+      if (!found_decimal) {
+        ++exponent;
+      }
+      if (digit != 0) {
+        is_truncated = true;
+      }
+    }
+  }
+  if (!found_digit) {
+    return requite::NumericResult::ERROR_NO_DIGITS;
+  }
+  if (!is_truncated && requite::getFastRealValue(significand, exponent,
+                                                 semantics, out_value)) {
+    return requite::NumericResult::OK;
+  }
   llvm::SmallString<16> buffer;
   requite::NumericResult result = requite::cleanRealText(text, buffer);
   if (result != requite::NumericResult::OK) {
@@ -123,6 +271,23 @@ getNumericValue(llvm::StringRef text, llvm::APFloat &out_value,
   return result;
 }
 
+bool getFittedInteger(const llvm::APSInt &value, unsigned depth,
+                      bool is_unsigned, llvm::APSInt &out_value) {
+  if (value.isNegative()) {
+    if (is_unsigned || value.getSignificantBits() > depth) {
+      return false;
+    }
+    out_value = value.extOrTrunc(depth);
+    return true;
+  }
+  const unsigned available_depth = is_unsigned ? depth : depth - 1;
+  if (value.getActiveBits() > available_depth) {
+    return false;
+  }
+  out_value = llvm::APSInt(value.zextOrTrunc(depth), is_unsigned);
+  return true;
+}
+
 requite::NumericResult cleanRealText(llvm::StringRef text,
                                       llvm::SmallString<16> &out_clean) {
   bool found_decimal = false;
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <requite/assert.hpp>
+
+#include <new>
+#include <utility>
+
+namespace requite {
+
+template <typename PoolParam, typename ValueParam>
+PoolIterator<PoolParam, ValueParam>::PoolIterator(PoolParam &pool,
+                                                  unsigned index)
+    : _pool_ptr(&pool), _index(index) {}
+
+template <typename PoolParam, typename ValueParam>
+requite::PoolIterator<PoolParam, ValueParam> &
+PoolIterator<PoolParam, ValueParam>::operator++() {
+  ++this->_index;
+  return *this;
+}
+
+template <typename PoolParam, typename ValueParam>
+requite::PoolIterator<PoolParam, ValueParam>
+PoolIterator<PoolParam, ValueParam>::operator++(int) {
+  Self old = *this;
+  ++this->_index;
+  return old;
+}
+
+template <typename PoolParam, typename ValueParam>
+bool PoolIterator<PoolParam, ValueParam>::operator==(const Self &rhs) const {
+  return this->_pool_ptr == rhs._pool_ptr && this->_index == rhs._index;
+}
+
+template <typename PoolParam, typename ValueParam>
+bool PoolIterator<PoolParam, ValueParam>::operator!=(const Self &rhs) const {
+  return !(*this == rhs);
+}
+
+template <typename PoolParam, typename ValueParam>
+ValueParam &PoolIterator<PoolParam, ValueParam>::operator*() const {
+  return requite::getRef(this->_pool_ptr).get(this->_index);
+}
+
+template <typename PoolParam, typename ValueParam>
+ValueParam *PoolIterator<PoolParam, ValueParam>::operator->() const {
+  return &requite::getRef(this->_pool_ptr).get(this->_index);
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+Pool<ValueParam, SLAB_SIZE_PARAM>::~Pool() {
+  // Values are destroyed newest first, the reverse of construction.
+  for (unsigned i = this->_size; i != 0; --i) {
+    this->getSlot(i - 1)->~ValueParam();
+  }
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+template <typename... ArgParams>
+ValueParam &Pool<ValueParam, SLAB_SIZE_PARAM>::make(ArgParams &&...args) {
+  if (this->_size == this->_slab_uptrs.size() * SLAB_SIZE_PARAM) {
+    this->_slab_uptrs.emplace_back(std::make_unique<Slab>());
+  }
+  ValueParam *slot_ptr = this->getSlot(this->_size);
+  ValueParam *value_ptr =
+      new (slot_ptr) ValueParam(std::forward<ArgParams>(args)...);
+  ++this->_size;
+  return *value_ptr;
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+unsigned Pool<ValueParam, SLAB_SIZE_PARAM>::getSize() const {
+  return this->_size;
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+bool Pool<ValueParam, SLAB_SIZE_PARAM>::getIsEmpty() const {
+  return this->_size == 0;
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+ValueParam &Pool<ValueParam, SLAB_SIZE_PARAM>::get(unsigned index) {
+  REQUITE_ASSERT(index < this->_size);
+  return *this->getSlot(index);
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+const ValueParam &Pool<ValueParam, SLAB_SIZE_PARAM>::get(unsigned index) const {
+  REQUITE_ASSERT(index < this->_size);
+  return *this->getSlot(index);
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+typename requite::Pool<ValueParam, SLAB_SIZE_PARAM>::Iterator
+Pool<ValueParam, SLAB_SIZE_PARAM>::begin() {
+  return Iterator(*this, 0);
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+typename requite::Pool<ValueParam, SLAB_SIZE_PARAM>::Iterator
+Pool<ValueParam, SLAB_SIZE_PARAM>::end() {
+  return Iterator(*this, this->_size);
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+typename requite::Pool<ValueParam, SLAB_SIZE_PARAM>::ConstIterator
+Pool<ValueParam, SLAB_SIZE_PARAM>::begin() const {
+  return ConstIterator(*this, 0);
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+typename requite::Pool<ValueParam, SLAB_SIZE_PARAM>::ConstIterator
+Pool<ValueParam, SLAB_SIZE_PARAM>::end() const {
+  return ConstIterator(*this, this->_size);
+}
+
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM>
+ValueParam *Pool<ValueParam, SLAB_SIZE_PARAM>::getSlot(unsigned index) const {
+  Slab &slab = *this->_slab_uptrs[index / SLAB_SIZE_PARAM];
+  return std::launder(reinterpret_cast<ValueParam *>(
+      slab._bytes + sizeof(ValueParam) * (index % SLAB_SIZE_PARAM)));
+}
+
+} // namespace requite
@@ -11,12 +11,7 @@ namespace requite {
 
 inline bool Scope::getHasInternalSymbolOfName(llvm::StringRef name) const {
   REQUITE_ASSERT(!name.empty());
-  llvm::StringMapConstIterator<requite::RootSymbol> it =
-      this->getInternalSymbolMap().find(name);
-  if (it != this->_internal_symbol_map.end()) {
-    return true;
-  }
-  return false;
+  return this->getInternalSymbolMap().getHasName(requite::HashedName(name));
 }
 
 template <typename SymbolArg> void Scope::addInternalSymbol(SymbolArg &symbol) {
@@ -24,9 +19,13 @@ template <typename SymbolArg> void Scope::addInternalSymbol(SymbolArg &symbol) {
   REQUITE_ASSERT(!this->getHasInternalSymbolOfName(symbol.getName()));
   REQUITE_ASSERT(!symbol.getHasContaining());
   symbol.setContaining(*this);
-  this->getInternalSymbolMap().insert(
-      std::pair<llvm::StringRef, requite::RootSymbol>(
-          symbol.getName(), requite::RootSymbol::makeUser(symbol)));
+  const bool is_inserted = this->getInternalSymbolMap().insert(
+      requite::HashedName(symbol.getName()),
+      requite::RootSymbol::makeUser(symbol));
+  REQUITE_ASSERT(is_inserted);
+  // The new name may shadow a binding cached by this scope or any scope it
+  // contains.
+  requite::Scope::advanceSymbolGeneration();
 }
 
 inline bool Scope::getHasExportSymbolOfName(llvm::StringRef name) const {
@@ -45,9 +44,10 @@ template <typename SymbolArg> void Scope::addExportSymbol(SymbolArg &symbol) {
   REQUITE_ASSERT(!symbol.getHasContaining());
   symbol.setContaining(*this);
   requite::ExportTable &export_table = this->getExportTable();
-  export_table.getSymbolMap().insert(
-      std::pair<llvm::StringRef, requite::RootSymbol>(
-          symbol.getName(), requite::RootSymbol::makeUser(symbol)));
+  const bool is_inserted = export_table.getSymbolMap().insert(
+      requite::HashedName(symbol.getName()),
+      requite::RootSymbol::makeUser(symbol));
+  REQUITE_ASSERT(is_inserted);
 }
 
 inline bool Scope::getHasSymbolOfName(llvm::StringRef name) const {
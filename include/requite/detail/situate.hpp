@@ -2036,8 +2036,8 @@ void Situator::situateNullaryExpression(requite::Expression &expression) {
   REQUITE_ASSERT(
       requite::getCanBeSituation<SITUATION_PARAM>(expression.getOpcode()));
   if (expression.getHasBranch()) {
-    this->getContext().logSourceMessage(
-        expression, requite::LogType::ERROR,
+    this->getContext().logIdentifiedSourceMessage(
+        expression, requite::LogType::ERROR, "unexpected-branches",
         llvm::Twine("expression with opcode \"") +
             requite::getName(expression.getOpcode()) + "\" in situation \"" +
             requite::getName<SITUATION_PARAM>() + "\" must not have branches");
@@ -2860,7 +2860,10 @@ void Situator::situateAssertExpression(requite::Expression &expression) {
         "assertion failure for expression: \n\n{0}\n\n at {1}:{2}:{3}\"",
         first.getSourceText(), location.file, location.line, location.column);
 
-    requite::Expression &next = requite::Expression::makeString(assertion_text);
+    // string literals reference their text, so it is kept in the module's
+    // text arena rather than in this local.
+    requite::Expression &next = requite::Expression::makeString(
+        this->getModule().saveText(assertion_text));
     next.setSourceInsertedAfter(first);
     first.setNext(next);
   }
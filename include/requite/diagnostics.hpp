@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <requite/log_type.hpp>
+#include <requite/opcode.hpp>
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/SMLoc.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace requite {
+
+// A message reported while compiling. A diagnostic with a valid location
+// points into a source buffer, a diagnostic with only a file name refers to a
+// whole file, and a diagnostic with neither is plain text. Diagnostics logged
+// through the Context carry a stable id, and those logged at an expression
+// carry its opcode, for machine readable output.
+struct Diagnostic final {
+  using Self = requite::Diagnostic;
+
+  requite::LogType _type = requite::LogType::ERROR;
+  llvm::SMLoc _location = {};
+  std::string _filename = {};
+  std::string _message = {};
+  llvm::StringRef _id = {};
+  requite::Opcode _opcode = requite::Opcode::__NONE;
+  llvm::SmallVector<llvm::SMRange, 1> _ranges = {};
+  llvm::SmallVector<llvm::SMFixIt, 0> _fixits = {};
+
+  // diagnostics.cpp
+  [[nodiscard]] requite::LogType getType() const;
+  [[nodiscard]] bool getHasLocation() const;
+  [[nodiscard]] llvm::SMLoc getLocation() const;
+  [[nodiscard]] bool getHasFilename() const;
+  [[nodiscard]] llvm::StringRef getFilename() const;
+  [[nodiscard]] llvm::StringRef getMessage() const;
+  [[nodiscard]] bool getHasId() const;
+  [[nodiscard]] llvm::StringRef getId() const;
+  [[nodiscard]] bool getHasOpcode() const;
+  [[nodiscard]] requite::Opcode getOpcode() const;
+  [[nodiscard]] llvm::ArrayRef<llvm::SMRange> getRanges() const;
+  [[nodiscard]] llvm::ArrayRef<llvm::SMFixIt> getFixits() const;
+  void render(const llvm::SourceMgr &source_mgr,
+              llvm::raw_ostream &ostream) const;
+};
+
+// The diagnostics reported by one thread, in the order that they were
+// reported. Only the owning thread appends to it.
+struct DiagnosticBuffer final {
+  using Self = requite::DiagnosticBuffer;
+
+  std::vector<requite::Diagnostic> _diagnostics = {};
+};
+
+// Collects diagnostics from every thread without contending on a lock, and
+// renders them together once compiling is done, sorted by where they occur in
+// the source so that the output does not depend on thread scheduling.
+//
+// Once the error limit has been reached, getIsErrorLimitReached tells passes
+// to stop early. Only the errors that come first in the source are rendered.
+struct Diagnostics final {
+  using Self = requite::Diagnostics;
+
+  static constexpr unsigned NO_ERROR_LIMIT = 0;
+
+  std::uint64_t _id;
+  unsigned _error_limit = Self::NO_ERROR_LIMIT;
+  std::atomic<unsigned> _error_count = 0;
+  std::mutex _buffer_mutex = {};
+  std::vector<std::unique_ptr<requite::DiagnosticBuffer>> _buffer_uptrs = {};
+
+  // diagnostics.cpp
+  Diagnostics();
+  Diagnostics(const Self &) = delete;
+  Diagnostics(Self &&) = delete;
+  ~Diagnostics() = default;
+  Self &operator=(const Self &) = delete;
+  Self &operator=(Self &&) = delete;
+  void setErrorLimit(unsigned limit);
+  [[nodiscard]] unsigned getErrorLimit() const;
+  [[nodiscard]] unsigned getErrorCount() const;
+  [[nodiscard]] bool getIsErrorLimitReached() const;
+  [[nodiscard]] bool getHasDroppedErrors() const;
+  void report(requite::Diagnostic &&diagnostic);
+  [[nodiscard]] requite::DiagnosticBuffer &getThreadBuffer();
+  void gather(std::vector<requite::Diagnostic> &out_diagnostics,
+              const llvm::SourceMgr &source_mgr);
+  void render(const llvm::SourceMgr &source_mgr, llvm::raw_ostream &ostream);
+
+  // write_diagnostics.cpp
+  void writeJson(const llvm::SourceMgr &source_mgr, llvm::raw_ostream &ostream,
+                 bool has_line_columns);
+  void writeSarif(const llvm::SourceMgr &source_mgr,
+                  llvm::raw_ostream &ostream, bool has_line_columns);
+};
+
+} // namespace requite
@@ -1,9 +1,9 @@
 #pragma once
 
 #include <requite/symbol.hpp>
+#include <requite/symbol_map.hpp>
 
 #include <llvm/ADT/StringRef.h>
-#include <llvm/ADT/StringMap.h>
 
 namespace requite {
 
@@ -12,7 +12,7 @@ struct Scope;
 struct ExportTable final {
   using Self = requite::ExportTable;
 
-  llvm::StringMap<requite::RootSymbol> _exported_symbol_map = {};
+  requite::SymbolMap _exported_symbol_map = {};
 
   // export_table.cpp
   ExportTable() = default;
@@ -23,12 +23,14 @@ struct ExportTable final {
   Self& operator=(Self&&) = delete;
   [[nodiscard]] bool operator==(const Self&) const;
   [[nodiscard]] bool operator!=(const Self&) const;
-  [[nodiscard]] llvm::StringMap<requite::RootSymbol> &getSymbolMap();
-  [[nodiscard]] const llvm::StringMap<requite::RootSymbol> &getSymbolMap() const;
+  [[nodiscard]] requite::SymbolMap &getSymbolMap();
+  [[nodiscard]] const requite::SymbolMap &getSymbolMap() const;
 
   // lookup_symbols.cpp
   [[nodiscard]]
   requite::RootSymbol lookupExportUserSymbol(llvm::StringRef name);
+  [[nodiscard]] requite::RootSymbol
+  lookupExportUserSymbol(const requite::HashedName &name);
 
   // detail/export_table_symbol_map.hpp
   [[nodiscard]] inline bool getHasExportSymbolOfName(llvm::StringRef name) const;
@@ -8,6 +8,7 @@
 #include <requite/expression_iterator.hpp>
 #include <requite/opcode.hpp>
 #include <requite/symbol.hpp>
+#include <requite/type_interner.hpp>
 
 #include <llvm/ADT/APSInt.h>
 #include <llvm/ADT/StringRef.h>
@@ -34,6 +35,9 @@ struct Expression final {
   using Self = requite::Expression;
 
   requite::Opcode _opcode = requite::Opcode::__NONE;
+  // expressions read from a binary ast share one array that their module
+  // owns, so deleting one of them only deletes the expressions it links to.
+  bool _is_in_array = false;
   requite::Expression *_next_ptr = nullptr;
   requite::Expression *_branch_ptr = nullptr;
   const char *_source_text_ptr = nullptr;
@@ -41,8 +45,9 @@ struct Expression final {
   std::variant<std::monostate, std::string, requite::Scope *,
                requite::Object *, requite::Procedure *, requite::Alias *,
                requite::AnonymousFunction *, requite::UnorderedVariable *, requite::OrderedVariable*,  requite::Label*, llvm::APSInt,
-               requite::Symbol>
+               requite::Symbol, llvm::StringRef>
       _data = std::monostate{};
+  requite::TypeHandle _resolved_type = {};
 
   // expression.cpp
   Expression() = default;
@@ -63,6 +68,8 @@ struct Expression final {
   makeOperation(requite::Opcode opcode);
   [[nodiscard]] static requite::Expression &makeInteger();
   [[nodiscard]] static requite::Expression &makeReal();
+  // string and codeunit literals reference their text, which must outlive
+  // the expression.
   [[nodiscard]] static requite::Expression &makeString(llvm::StringRef text);
   [[nodiscard]] static requite::Expression &makeCodeunit(llvm::StringRef text);
   [[nodiscard]] static requite::Expression &
@@ -90,6 +97,9 @@ struct Expression final {
   [[nodiscard]] inline bool getHasNext() const;
   [[nodiscard]] inline bool getHasOneBranch() const;
   [[nodiscard]] inline bool getHasOneNext() const;
+  // counts and indexed access walk the sibling list. they are not cached
+  // because every pass rewrites the tree in place. the situator takes arity
+  // from the walk that situates the branches instead of counting them.
   [[nodiscard]] inline unsigned getBranchCount() const;
   [[nodiscard]] inline unsigned getNextCount() const;
   [[nodiscard]] inline requite::Expression &getBranch();
@@ -197,6 +207,9 @@ struct Expression final {
   [[nodiscard]] inline llvm::APSInt &emplaceInteger();
   [[nodiscard]] inline llvm::APSInt &getInteger();
   [[nodiscard]] inline const llvm::APSInt &getInteger() const;
+  [[nodiscard]] inline bool getHasResolvedType() const;
+  [[nodiscard]] inline requite::TypeHandle getResolvedType() const;
+  inline void setResolvedType(requite::TypeHandle type);
 
   // detail/expression_walk.hpp
   [[nodiscard]] inline requite::ExpressionWalker walkBranch();
@@ -6,12 +6,30 @@
 
 #include <requite/expression_walk_result.hpp>
 
-#include <functional>
+#include <concepts>
 
 namespace requite {
 
 struct Expression;
 
+// The walkers take their predicates as template parameters rather than
+// std::function so that the lambdas passed to them are inlined into the walk.
+template <typename PredicateParam>
+concept ExpressionVisitor =
+    std::invocable<PredicateParam &, requite::Expression &>;
+
+template <typename PredicateParam>
+concept IndexedExpressionVisitor =
+    std::invocable<PredicateParam &, unsigned, requite::Expression &>;
+
+template <typename PredicateParam>
+concept ExpressionPredicate =
+    std::predicate<PredicateParam &, requite::Expression &>;
+
+template <typename PredicateParam>
+concept IndexedExpressionPredicate =
+    std::predicate<PredicateParam &, unsigned, requite::Expression &>;
+
 struct ExpressionWalker final {
   using Self = requite::ExpressionWalker;
 
@@ -35,56 +53,48 @@ struct ExpressionWalker final {
 
   [[nodiscard]] inline requite::ExpressionWalkResult getResult() const;
 
-  inline Self &
-  doOne(std::function<void(requite::Expression &branch)> predicate);
+  template <requite::ExpressionVisitor PredicateParam>
+  inline Self &doOne(PredicateParam &&predicate);
 
-  inline bool
-  tryOne(std::function<bool(unsigned branch_i, requite::Expression &branch)>
-             predicate);
+  template <requite::IndexedExpressionVisitor PredicateParam>
+  inline Self &doOne(PredicateParam &&predicate);
 
-  inline bool
-  tryOne(std::function<bool(requite::Expression &branch)> predicate);
+  template <requite::IndexedExpressionPredicate PredicateParam>
+  inline bool tryOne(PredicateParam &&predicate);
 
-  inline Self &
-  doOne(std::function<void(unsigned branch_i, requite::Expression &branch)>
-            predicate);
+  template <requite::ExpressionPredicate PredicateParam>
+  inline bool tryOne(PredicateParam &&predicate);
 
-  template <unsigned COUNT_PARAM>
-  inline Self &
-  doSome(std::function<void(requite::Expression &branch)> predicate);
+  template <unsigned COUNT_PARAM, requite::ExpressionVisitor PredicateParam>
+  inline Self &doSome(PredicateParam &&predicate);
 
-  template <unsigned COUNT_PARAM>
-  inline Self &
-  doSome(std::function<void(unsigned branch_i, requite::Expression &branch)>
-             predicate);
+  template <unsigned COUNT_PARAM,
+            requite::IndexedExpressionVisitor PredicateParam>
+  inline Self &doSome(PredicateParam &&predicate);
 
-  inline requite::ExpressionWalkResult
-  doAll(std::function<void(requite::Expression &branch)> predicate);
+  template <requite::ExpressionVisitor PredicateParam>
+  inline requite::ExpressionWalkResult doAll(PredicateParam &&predicate);
 
-  inline requite::ExpressionWalkResult
-  doAll(std::function<void(unsigned branch_i, requite::Expression &branch)>
-            predicate);
+  template <requite::IndexedExpressionVisitor PredicateParam>
+  inline requite::ExpressionWalkResult doAll(PredicateParam &&predicate);
 
-  inline Self &
-  doUntilLast(std::function<void(requite::Expression &branch)> predicate);
+  template <requite::ExpressionVisitor PredicateParam>
+  inline Self &doUntilLast(PredicateParam &&predicate);
 
-  inline Self &doUntilLast(
-      std::function<void(unsigned branch_i, requite::Expression &branch)>
-          predicate);
+  template <requite::IndexedExpressionVisitor PredicateParam>
+  inline Self &doUntilLast(PredicateParam &&predicate);
 
-  inline Self &doUntilLastOrCondition(
-      std::function<bool(requite::Expression &branch)> predicate);
+  template <requite::ExpressionPredicate PredicateParam>
+  inline Self &doUntilLastOrCondition(PredicateParam &&predicate);
 
-  inline Self &doUntilLastOrCondition(
-      std::function<bool(unsigned branch_i, requite::Expression &branch)>
-          predicate);
+  template <requite::IndexedExpressionPredicate PredicateParam>
+  inline Self &doUntilLastOrCondition(PredicateParam &&predicate);
 
-  inline requite::ExpressionWalkResult
-  doLast(std::function<void(requite::Expression &branch)> predicate);
+  template <requite::ExpressionVisitor PredicateParam>
+  inline requite::ExpressionWalkResult doLast(PredicateParam &&predicate);
 
-  inline requite::ExpressionWalkResult
-  doLast(std::function<void(unsigned branch_i, requite::Expression &branch)>
-             predicate);
+  template <requite::IndexedExpressionVisitor PredicateParam>
+  inline requite::ExpressionWalkResult doLast(PredicateParam &&predicate);
 };
 
 } // namespace requite
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <cstdint>
+
+namespace requite {
+
+struct ExportTable;
+
+// A fingerprint records everything a module's build output depends on. It is
+// stored next to the output so that a later build can tell whether the output
+// is still valid without rebuilding it.
+//
+// The export hash is recorded so that modules importing this one can detect
+// when the exported interface changed. Edits that do not change the exported
+// symbols leave the export hash alone, so importers are not rebuilt.
+struct Fingerprint final {
+  using Self = requite::Fingerprint;
+
+  std::uint64_t _source_hash = 0;
+  std::uint64_t _flags_hash = 0;
+  std::uint64_t _export_hash = 0;
+  llvm::StringMap<std::uint64_t> _import_export_hashes = {};
+
+  // fingerprint.cpp
+  Fingerprint() = default;
+  Fingerprint(const Self &) = delete;
+  Fingerprint(Self &&) = default;
+  ~Fingerprint() = default;
+  Self &operator=(const Self &) = delete;
+  Self &operator=(Self &&) = default;
+  [[nodiscard]] std::uint64_t getSourceHash() const;
+  void setSourceHash(llvm::StringRef source_text);
+  [[nodiscard]] std::uint64_t getFlagsHash() const;
+  void setFlagsHash(llvm::StringRef target_triple);
+  [[nodiscard]] std::uint64_t getExportHash() const;
+  void setExportHash(const requite::ExportTable &table);
+  [[nodiscard]] llvm::StringMap<std::uint64_t> &getImportExportHashes();
+  [[nodiscard]] const llvm::StringMap<std::uint64_t> &
+  getImportExportHashes() const;
+  void addImport(llvm::StringRef fingerprint_path, std::uint64_t export_hash);
+  [[nodiscard]] bool getIsInputSame(const Self &rhs) const;
+  void write(llvm::raw_ostream &ostream) const;
+  [[nodiscard]] bool read(llvm::StringRef text);
+};
+
+// fingerprint.cpp
+void getFingerprintPath(llvm::SmallVectorImpl<char> &out_path,
+                        llvm::StringRef output_path);
+
+} // namespace requite
@@ -5,12 +5,16 @@
 #pragma once
 
 #include <requite/file.hpp>
+#include <requite/fingerprint.hpp>
 #include <requite/scope.hpp>
 
 #include <llvm/ADT/SmallVector.h>
 #include <llvm/ADT/StringRef.h>
+#include <llvm/Support/Allocator.h>
+#include <llvm/Support/MemoryBuffer.h>
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -29,13 +33,19 @@ struct Module final {
   requite::File _file = {};
   requite::ExportTable *_export_tble_ptr = nullptr;
   requite::Procedure *_entry_point_ptr = nullptr;
+  requite::Fingerprint _fingerprint = {};
+  llvm::BumpPtrAllocator _text_allocator = {};
+  std::mutex _text_mutex = {};
+  std::unique_ptr<llvm::MemoryBuffer> _binary_ast_buffer_uptr = {};
+  std::unique_ptr<requite::Expression[]> _binary_ast_expressions_uptr = {};
+  bool _is_tabulated = false;
 
   Module();
   Module(Self &that) = delete;
   Module(Self &&that) = delete;
   Self &operator=(Self &rhs) = delete;
   Self &operator=(Self &&rhs) = delete;
-  ~Module() = default;
+  ~Module();
 
   // module_symbols.cpp
 
@@ -65,6 +75,12 @@ struct Module final {
   void addEntryPoint(requite::Procedure &entry_point);
   [[nodiscard]] requite::Procedure &getEntryPoint();
   [[nodiscard]] const requite::Procedure &getEntryPoint() const;
+  [[nodiscard]] requite::Fingerprint &getFingerprint();
+  [[nodiscard]] const requite::Fingerprint &getFingerprint() const;
+  // safe to call from the tasks of a parallel pass.
+  [[nodiscard]] llvm::StringRef saveText(llvm::StringRef text);
+  [[nodiscard]] bool getIsTabulated() const;
+  void setIsTabulated();
 };
 
 } // namespace requite
\ No newline at end of file
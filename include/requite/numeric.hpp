@@ -7,9 +7,13 @@
 #include <requite/float_semantics.hpp>
 #include <requite/numeric_result.hpp>
 
+#include <llvm/ADT/APFloat.h>
+#include <llvm/ADT/APSInt.h>
 #include <llvm/ADT/SmallString.h>
 #include <llvm/ADT/StringRef.h>
 
+#include <cstdint>
+
 namespace requite {
 
 static constexpr unsigned MAX_BASE = 64;
@@ -27,9 +31,23 @@ getNumericValue(llvm::StringRef text, llvm::APFloat &out_value,
 [[nodiscard]] inline int
 getIntegerDepthRequired(llvm::StringRef value_portion_text, unsigned base);
 
+// Converts an integer to the given depth and signedness. Fails if the value
+// is not representable there.
+[[nodiscard]] inline bool getFittedInteger(const llvm::APSInt &value,
+                                           unsigned depth, bool is_unsigned,
+                                           llvm::APSInt &out_value);
+
 [[nodiscard]] inline requite::NumericResult
 cleanRealText(llvm::StringRef text, llvm::SmallString<16> &out_clean);
 
+// numeric.cpp
+// Converts significand * 10^exponent to half, single or double precision.
+// Returns false for other semantics and for the rare inputs that need the
+// slow path, in which case the value must be converted with llvm::APFloat.
+[[nodiscard]] bool getFastRealValue(std::uint64_t significand, int exponent,
+                                    requite::FloatSemantics semantics,
+                                    llvm::APFloat &out_value);
+
 } // namespace requite
 
 #include <requite/detail/numeric.hpp>
\ No newline at end of file
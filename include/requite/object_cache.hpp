@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Target/TargetMachine.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace requite {
+
+// A content addressed cache of emitted object files. Entries are keyed by a
+// hash of the llvm module together with every target machine setting that
+// changes the emitted code, so a hit can be copied to the output without
+// running code generation.
+//
+// Entries are kept under the cache directory as individual files. Hits
+// refresh the access time of their entry, and the directory is pruned from
+// least to most recently used whenever it grows beyond the size limit.
+struct ObjectCache final {
+  using Self = requite::ObjectCache;
+
+  std::string _directory = {};
+  std::uint64_t _size_limit = 0;
+  unsigned _hit_count = 0;
+  unsigned _miss_count = 0;
+
+  // object_cache.cpp
+  ObjectCache() = default;
+  ObjectCache(const Self &) = delete;
+  ObjectCache(Self &&) = delete;
+  ~ObjectCache() = default;
+  Self &operator=(const Self &) = delete;
+  Self &operator=(Self &&) = delete;
+  [[nodiscard]] bool getIsEnabled() const;
+  void enable(llvm::StringRef directory, std::uint64_t size_limit);
+  [[nodiscard]] llvm::StringRef getDirectory() const;
+  [[nodiscard]] std::uint64_t getSizeLimit() const;
+  [[nodiscard]] unsigned getHitCount() const;
+  [[nodiscard]] unsigned getMissCount() const;
+  static void getKey(llvm::SmallVectorImpl<char> &out_key,
+                     const llvm::Module &module,
+                     const llvm::TargetMachine &target_machine);
+  [[nodiscard]] std::unique_ptr<llvm::MemoryBuffer>
+  lookup(llvm::StringRef key);
+  [[nodiscard]] std::error_code insert(llvm::StringRef key,
+                                       llvm::StringRef object);
+  void prune() const;
+  void getEntryPath(llvm::SmallVectorImpl<char> &out_path,
+                    llvm::StringRef key) const;
+};
+
+} // namespace requite
@@ -6,13 +6,16 @@
 
 #include <llvm/ADT/StringRef.h>
 
+#include <cstdint>
 #include <string>
 
 namespace requite {
 
 enum Emit {
   EMIT_TOKENS,
+  EMIT_TOKENS_BINARY,
   EMIT_PARSED,
+  EMIT_AST_BINARY,
   EMIT_SITUATED,
   EMIT_CONTEXTUALIZED,
   EMIT_SYMBOLS,
@@ -27,6 +30,12 @@ enum Form {
   FORM_MULTIPLICATIVE = (FORM_NORMATIVE | FORM_INTERMEDIATE)
 };
 
+enum DiagnosticsFormat {
+  DIAGNOSTICS_FORMAT_TEXT,
+  DIAGNOSTICS_FORMAT_JSON,
+  DIAGNOSTICS_FORMAT_SARIF
+};
+
 [[nodiscard]] llvm::StringRef getInputFilePath();
 
 [[nodiscard]] llvm::StringRef getOutputFilePath();
@@ -35,6 +44,24 @@ enum Form {
 
 [[nodiscard]] requite::Form getForm();
 
+[[nodiscard]] bool getIsIncremental();
+
+[[nodiscard]] bool getIsTabulationFused();
+
+[[nodiscard]] unsigned getJobCount();
+
+[[nodiscard]] llvm::StringRef getObjectCacheDirectory();
+
+[[nodiscard]] std::uint64_t getObjectCacheSizeLimitInMegabytes();
+
+[[nodiscard]] bool getIsObjectCacheStatsShown();
+
+[[nodiscard]] unsigned getErrorLimit();
+
+[[nodiscard]] requite::DiagnosticsFormat getDiagnosticsFormat();
+
+[[nodiscard]] bool getIsDiagnosticsLineColumnShown();
+
 [[nodiscard]] bool getIsNormativeRequiteOk();
 
 [[nodiscard]] bool getIsIntermediateRequiteOk();
@@ -6,6 +6,7 @@
 
 #include <requite/variable_type.hpp>
 #include <requite/symbol.hpp>
+#include <requite/type_interner.hpp>
 
 #include <llvm/ADT/StringRef.h>
 
@@ -29,7 +30,9 @@ struct OrderedVariable final {
   std::string _name = {};
   requite::VariableType _type = requite::VariableType::NONE;
   requite::Expression *_expression_ptr = nullptr;
+  // Locals only keep the interned type that prototyping inferred for them.
   requite::Symbol _data_type = {};
+  requite::TypeHandle _interned_data_type = {};
   requite::Scope *_containing_scope_ptr = nullptr;
   llvm::AllocaInst* _llvm_alloca_ptr = nullptr;
 
@@ -51,6 +54,9 @@ struct OrderedVariable final {
   [[nodiscard]] const requite::Expression &getExpression() const;
   [[nodiscard]] requite::Symbol &getDataType();
   [[nodiscard]] const requite::Symbol& getDataType() const;
+  [[nodiscard]] bool getHasInternedDataType() const;
+  void setInternedDataType(requite::TypeHandle type);
+  [[nodiscard]] requite::TypeHandle getInternedDataType() const;
   [[nodiscard]] bool getHasContaining() const;
   void setContaining(requite::Scope &scope);
   [[nodiscard]] requite::Scope &getContaining();
@@ -44,8 +44,9 @@ struct Parser final {
   void logErrorInvalidOperatorSpacing(const requite::Token &token);
 
   [[nodiscard]]
-  std::string getText(llvm::StringRef log_message_type_text,
-                      const requite::Token &token, llvm::StringRef source_text);
+  llvm::StringRef getText(llvm::StringRef log_message_type_text,
+                          const requite::Token &token,
+                          llvm::StringRef source_text);
 
   [[nodiscard]]
   requite::Module &getModule();
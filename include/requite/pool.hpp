@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace requite {
+
+template <typename PoolParam, typename ValueParam> struct PoolIterator final {
+  using Self = requite::PoolIterator<PoolParam, ValueParam>;
+  using value_type = ValueParam;
+  using reference = ValueParam &;
+  using pointer = ValueParam *;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::forward_iterator_tag;
+
+  PoolParam *_pool_ptr = nullptr;
+  unsigned _index = 0;
+
+  PoolIterator() = default;
+  inline PoolIterator(PoolParam &pool, unsigned index);
+
+  inline Self &operator++();
+  inline Self operator++(int);
+  [[nodiscard]] inline bool operator==(const Self &rhs) const;
+  [[nodiscard]] inline bool operator!=(const Self &rhs) const;
+  [[nodiscard]] inline reference operator*() const;
+  [[nodiscard]] inline pointer operator->() const;
+};
+
+// Owns every value of one type that is created over the lifetime of a
+// context. Values are constructed in place inside fixed size slabs, so their
+// addresses never change, neighbouring values share cache lines and a value
+// can be referred to by the index it was created at. Every value is destroyed
+// together when the pool is.
+template <typename ValueParam, unsigned SLAB_SIZE_PARAM = 64>
+struct Pool final {
+  using Self = requite::Pool<ValueParam, SLAB_SIZE_PARAM>;
+  using Iterator = requite::PoolIterator<Self, ValueParam>;
+  using ConstIterator = requite::PoolIterator<const Self, const ValueParam>;
+
+  static_assert(SLAB_SIZE_PARAM != 0);
+
+  struct Slab final {
+    alignas(ValueParam) std::byte _bytes[sizeof(ValueParam) * SLAB_SIZE_PARAM];
+  };
+
+  std::vector<std::unique_ptr<Slab>> _slab_uptrs = {};
+  unsigned _size = 0;
+
+  // detail/pool.hpp
+  Pool() = default;
+  Pool(const Self &) = delete;
+  Pool(Self &&) = delete;
+  inline ~Pool();
+  Self &operator=(const Self &) = delete;
+  Self &operator=(Self &&) = delete;
+  template <typename... ArgParams>
+  [[nodiscard]] inline ValueParam &make(ArgParams &&...args);
+  [[nodiscard]] inline unsigned getSize() const;
+  [[nodiscard]] inline bool getIsEmpty() const;
+  [[nodiscard]] inline ValueParam &get(unsigned index);
+  [[nodiscard]] inline const ValueParam &get(unsigned index) const;
+  [[nodiscard]] inline Iterator begin();
+  [[nodiscard]] inline Iterator end();
+  [[nodiscard]] inline ConstIterator begin() const;
+  [[nodiscard]] inline ConstIterator end() const;
+  [[nodiscard]] inline ValueParam *getSlot(unsigned index) const;
+};
+
+} // namespace requite
+
+#include <requite/detail/pool.hpp>
@@ -8,10 +8,11 @@
 #include <requite/node.hpp>
 #include <requite/scope_type.hpp>
 #include <requite/symbol.hpp>
+#include <requite/symbol_map.hpp>
 
-#include <llvm/ADT/StringMap.h>
 #include <llvm/ADT/StringRef.h>
 
+#include <cstdint>
 #include <memory>
 #include <ranges>
 #include <vector>
@@ -34,7 +35,9 @@ struct Scope final {
   unsigned _scope_depth = 0;
   requite::Scope *_containing_scope_ptr = nullptr;
   requite::ExportTable *_export_table_ptr = nullptr;
-  llvm::StringMap<requite::RootSymbol> _internal_symbol_map = {};
+  requite::SymbolMap _internal_symbol_map = {};
+  requite::SymbolMap _visible_symbol_cache = {};
+  std::uint64_t _visible_symbol_cache_generation = 0;
   requite::ScopeType _type = requite::ScopeType::NONE;
   union {
     void *_nothing_ptr = nullptr;
@@ -62,9 +65,8 @@ struct Scope final {
   [[nodiscard]] requite::Module &getModule();
   [[nodiscard]] const requite::Module &getModule() const;
   [[nodiscard]] requite::ScopeType getType() const;
-  [[nodiscard]] llvm::StringMap<requite::RootSymbol> &getInternalSymbolMap();
-  [[nodiscard]] const llvm::StringMap<requite::RootSymbol> &
-  getInternalSymbolMap() const;
+  [[nodiscard]] requite::SymbolMap &getInternalSymbolMap();
+  [[nodiscard]] const requite::SymbolMap &getInternalSymbolMap() const;
   [[nodiscard]] bool getHasContaining() const;
   void setContaining(requite::Scope &scope);
   [[nodiscard]] requite::Scope &getContaining();
@@ -101,10 +103,20 @@ struct Scope final {
   // lookup_symbols.cpp
   [[nodiscard]]
   requite::RootSymbol lookupInternalUserSymbol(llvm::StringRef name);
+  [[nodiscard]] requite::RootSymbol
+  lookupInternalUserSymbol(const requite::HashedName &name);
   [[nodiscard]]
   requite::RootSymbol lookupExportUserSymbol(llvm::StringRef name);
+  [[nodiscard]] requite::RootSymbol
+  lookupExportUserSymbol(const requite::HashedName &name);
   [[nodiscard]]
   requite::RootSymbol lookupUserSymbol(llvm::StringRef name);
+  [[nodiscard]] requite::RootSymbol
+  lookupUserSymbol(const requite::HashedName &name);
+  [[nodiscard]] requite::RootSymbol
+  lookupVisibleTypeSymbol(const requite::HashedName &name);
+  [[nodiscard]] static std::uint64_t getSymbolGeneration();
+  static void advanceSymbolGeneration();
 
   // detail/scope_symbol_map.hpp
   [[nodiscard]] inline bool getHasInternalSymbolOfName(llvm::StringRef name) const;
@@ -37,6 +37,9 @@ struct Situator final {
   void setIsOk();
   [[nodiscard]]
   bool situateAst();
+  [[nodiscard]]
+  bool situateAndTabulateAst();
+  void situateModuleInParallel(requite::Expression &root);
   void insertModuleRoot();
 
   // detail/situate/situate.hpp
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <requite/source_location.hpp>
+
+#include <llvm/ADT/StringRef.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace requite {
+
+// The offset of every line start in one source buffer, found in a single scan
+// so that locations can be looked up without rescanning the text. Lines are
+// split on '\n' and counted from 1, as llvm::SourceMgr does.
+//
+// Lookups remember the line they last found. Walking the ast visits nodes
+// mostly in source order, so the next location is usually on the same line or
+// the one after and is found without a search.
+struct SourceLineTable final {
+  using Self = requite::SourceLineTable;
+
+  llvm::StringRef _identifier = {};
+  llvm::StringRef _text = {};
+  std::vector<std::uint32_t> _line_offsets = {};
+  std::uint32_t _last_line_i = 0;
+
+  // source_line_table.cpp
+  SourceLineTable() = default;
+  SourceLineTable(llvm::StringRef identifier, llvm::StringRef text);
+  SourceLineTable(const Self &) = delete;
+  SourceLineTable(Self &&) = default;
+  ~SourceLineTable() = default;
+  Self &operator=(const Self &) = delete;
+  Self &operator=(Self &&) = default;
+  [[nodiscard]] unsigned getLineCount() const;
+  [[nodiscard]] bool getHasLocation(const char *text_ptr) const;
+  [[nodiscard]] requite::SourceLocation getLocation(const char *text_ptr);
+};
+
+} // namespace requite
@@ -18,5 +18,10 @@ static constexpr std::string_view ENTRY_POINT_MANGLED_NAME = "main";
 
 static constexpr std::string_view PROCEDURE_ENTRY_BLOCK_NAME = "entry";
 
+static constexpr std::string_view FINGERPRINT_FILE_EXTENSION = ".fingerprint";
+
+// Bump whenever a compiler change could alter the output for the same input so
+// that stale outputs from an older compiler are not reused.
+static constexpr std::string_view FINGERPRINT_VERSION = "requite-2";
 
 } // namespace requite
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include <llvm/ADT/ArrayRef.h>
 #include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/SmallVector.h>
 #include <llvm/ADT/StringRef.h>
 
 #include <memory>
@@ -80,7 +81,7 @@ struct RootSymbol final {
   using Self = requite::RootSymbol;
 
   requite::RootSymbolType _type = requite::RootSymbolType::NONE;
-  unsigned _depth;
+  unsigned _depth = 0;
   union {
     void *_data_ptr = nullptr;
     requite::Signature *_signature_ptr;
@@ -101,10 +102,10 @@ struct RootSymbol final {
   // root_symbol.cpp
   RootSymbol() = default;
   RootSymbol(const Self &that);
-  RootSymbol(Self &&that) = default;
+  RootSymbol(Self &&that);
   ~RootSymbol();
   Self &operator=(const Self &rhs);
-  Self &operator=(Self &&rhs) = default;
+  Self &operator=(Self &&rhs);
   [[nodiscard]] bool operator==(const Self &rhs) const;
   [[nodiscard]] bool operator!=(const Self &rhs) const;
   [[nodiscard]] static Self makeUser(requite::Scope &scope);
@@ -246,9 +247,13 @@ struct SubSymbol final {
 struct Symbol {
   using Self = requite::Symbol;
 
+  // Nearly every symbol has at most a reference or pointer wrapped around its
+  // root, so a couple of sub symbols are stored inline without allocating.
+  static constexpr unsigned INLINE_SUB_COUNT = 2;
+
   requite::RootSymbol _root = {};
   requite::AttributeFlags _root_attributes = {};
-  std::vector<requite::SubSymbol> _subs = {};
+  llvm::SmallVector<requite::SubSymbol, INLINE_SUB_COUNT> _subs = {};
 
   // symbol.cpp
   Symbol() = default;
@@ -267,8 +272,9 @@ struct Symbol {
   [[nodiscard]] const requite::RootSymbol &getRoot() const;
   [[nodiscard]] requite::AttributeFlags &getRootAttributeFlags();
   [[nodiscard]] const requite::AttributeFlags &getRootAttributeFlags() const;
-  [[nodiscard]] std::vector<requite::SubSymbol> &getSubs();
-  [[nodiscard]] const std::vector<requite::SubSymbol> &getSubs() const;
+  [[nodiscard]] llvm::SmallVectorImpl<requite::SubSymbol> &getSubs();
+  [[nodiscard]] const llvm::SmallVectorImpl<requite::SubSymbol> &
+  getSubs() const;
   void wrapSymbol(const requite::Symbol &symbol);
   void applyAttributeFlags(const requite::AttributeFlags &attributes);
   [[nodiscard]] requite::SubSymbol &makeSubSymbol();
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <requite/symbol.hpp>
+
+#include <llvm/ADT/StringRef.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace requite {
+
+// A name paired with its hash so that the hash is computed once and reused
+// for every symbol map the name is looked up in.
+struct HashedName final {
+  using Self = requite::HashedName;
+
+  llvm::StringRef _text = {};
+  std::uint64_t _hash = 0;
+
+  // symbol_map.cpp
+  HashedName() = default;
+  explicit HashedName(llvm::StringRef text);
+  [[nodiscard]] llvm::StringRef getText() const;
+  [[nodiscard]] std::uint64_t getHash() const;
+};
+
+struct SymbolMapEntry final {
+  using Self = requite::SymbolMapEntry;
+
+  std::string _name = {};
+  std::uint64_t _hash = 0;
+  requite::RootSymbol _symbol = {};
+
+  // symbol_map.cpp
+  [[nodiscard]] llvm::StringRef getName() const;
+  [[nodiscard]] std::uint64_t getHash() const;
+  [[nodiscard]] requite::RootSymbol &getSymbol();
+  [[nodiscard]] const requite::RootSymbol &getSymbol() const;
+};
+
+// An open addressing hash table from names to root symbols.
+//
+// Entries are kept densely in insertion order and the linearly probed slot
+// array only holds entry indices, so probing touches a small contiguous array
+// and growing the slots only rehashes indices.
+//
+// The entries live in a vector, so an insert may move them. Pointers returned
+// by find and iterators are invalidated by insert and clear, and callers copy
+// the root symbol out before the map can change.
+struct SymbolMap final {
+  using Self = requite::SymbolMap;
+  using Entry = requite::SymbolMapEntry;
+
+  static constexpr std::uint32_t EMPTY_SLOT = 0;
+  static constexpr unsigned MINIMUM_SLOT_COUNT = 8;
+
+  std::vector<Entry> _entries = {};
+  std::vector<std::uint32_t> _slots = {};
+
+  // symbol_map.cpp
+  SymbolMap() = default;
+  SymbolMap(const Self &) = delete;
+  SymbolMap(Self &&) = default;
+  ~SymbolMap() = default;
+  Self &operator=(const Self &) = delete;
+  Self &operator=(Self &&) = default;
+  [[nodiscard]] bool getIsEmpty() const;
+  [[nodiscard]] unsigned getSize() const;
+  [[nodiscard]] bool getHasName(const requite::HashedName &name) const;
+  [[nodiscard]] requite::RootSymbol *find(const requite::HashedName &name);
+  [[nodiscard]] const requite::RootSymbol *
+  find(const requite::HashedName &name) const;
+  [[nodiscard]] bool insert(const requite::HashedName &name,
+                            requite::RootSymbol &&symbol);
+  void clear();
+  [[nodiscard]] std::vector<Entry>::const_iterator begin() const;
+  [[nodiscard]] std::vector<Entry>::const_iterator end() const;
+  [[nodiscard]] unsigned findSlot(const requite::HashedName &name) const;
+  void grow();
+};
+
+} // namespace requite
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <requite/pool.hpp>
+#include <requite/symbol.hpp>
+
+#include <llvm/ADT/DenseMapInfo.h>
+#include <llvm/ADT/DenseSet.h>
+
+#include <cstddef>
+#include <mutex>
+
+namespace requite {
+
+// A pointer sized reference to a type interned by a TypeInterner. Structurally
+// equal types share one interned symbol, so handles compare and copy without
+// looking at the symbol.
+struct TypeHandle final {
+  using Self = requite::TypeHandle;
+
+  const requite::Symbol *_symbol_ptr = nullptr;
+
+  // type_interner.cpp
+  TypeHandle() = default;
+  explicit TypeHandle(const requite::Symbol &symbol);
+  [[nodiscard]] bool operator==(const Self &rhs) const;
+  [[nodiscard]] bool operator!=(const Self &rhs) const;
+  [[nodiscard]] bool getIsNone() const;
+  [[nodiscard]] const requite::Symbol &getSymbol() const;
+};
+
+// Keys the interned symbols by value. Lookups are made with the symbol being
+// interned, so no copy is made until the symbol turns out to be new.
+struct InternedSymbolInfo final {
+  using Self = requite::InternedSymbolInfo;
+
+  // type_interner.cpp
+  [[nodiscard]] static const requite::Symbol *getEmptyKey();
+  [[nodiscard]] static const requite::Symbol *getTombstoneKey();
+  [[nodiscard]] static unsigned getHashValue(const requite::Symbol *symbol_ptr);
+  [[nodiscard]] static unsigned getHashValue(const requite::Symbol &symbol);
+  [[nodiscard]] static bool isEqual(const requite::Symbol *lhs_ptr,
+                                    const requite::Symbol *rhs_ptr);
+  [[nodiscard]] static bool isEqual(const requite::Symbol &lhs,
+                                    const requite::Symbol *rhs_ptr);
+};
+
+// Hash conses finished types. Each distinct type is copied into the interner
+// once, and every later request for an equal type returns the same handle.
+struct TypeInterner final {
+  using Self = requite::TypeInterner;
+
+  std::mutex _mutex = {};
+  requite::Pool<requite::Symbol> _symbol_pool = {};
+  llvm::DenseSet<const requite::Symbol *, requite::InternedSymbolInfo>
+      _symbols = {};
+
+  // type_interner.cpp
+  TypeInterner() = default;
+  TypeInterner(const Self &) = delete;
+  TypeInterner(Self &&) = delete;
+  ~TypeInterner() = default;
+  Self &operator=(const Self &) = delete;
+  Self &operator=(Self &&) = delete;
+  [[nodiscard]] requite::TypeHandle intern(const requite::Symbol &symbol);
+  [[nodiscard]] unsigned getSize() const;
+};
+
+// type_interner.cpp
+[[nodiscard]] std::size_t getHash(const requite::Symbol &symbol);
+
+} // namespace requite
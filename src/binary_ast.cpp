@@ -0,0 +1,386 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include <requite/assert.hpp>
+#include <requite/binary_ast.hpp>
+#include <requite/context.hpp>
+#include <requite/expression.hpp>
+#include <requite/module.hpp>
+#include <requite/utility.hpp>
+
+#include <llvm/ADT/APInt.h>
+#include <llvm/ADT/APSInt.h>
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/Twine.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MathExtras.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace requite {
+
+[[nodiscard]] static std::uint64_t getBinaryAstAligned(std::uint64_t offset) {
+  return llvm::alignTo(offset, 8);
+}
+
+static void writeBinaryAstPadding(llvm::raw_ostream &ostream,
+                                  std::uint64_t size) {
+  static constexpr char ZEROES[8] = {};
+  ostream.write(ZEROES, requite::getBinaryAstAligned(size) - size);
+}
+
+[[nodiscard]] static bool getIsBinaryAstSectionValid(llvm::StringRef data,
+                                                     std::uint64_t offset,
+                                                     std::uint64_t size) {
+  return offset <= data.size() && size <= data.size() - offset;
+}
+
+void writeBinaryAst(const requite::Expression *first,
+                    llvm::StringRef identifier, llvm::StringRef source_text,
+                    llvm::raw_ostream &ostream) {
+  struct Pending final {
+    const requite::Expression *_expression_ptr;
+    std::uint32_t _link_i;
+    bool _is_branch_link;
+  };
+  std::vector<requite::BinaryAstNode> nodes;
+  std::string text;
+  std::vector<std::uint64_t> words;
+  std::uint32_t root_i = requite::BINARY_AST_NO_INDEX;
+  // Nodes are numbered in preorder with branches before nexts, so every link
+  // points forward and the root is the first node.
+  llvm::SmallVector<Pending, 32> pending_stack;
+  if (first != nullptr) {
+    pending_stack.push_back({first, requite::BINARY_AST_NO_INDEX, false});
+  }
+  while (!pending_stack.empty()) {
+    const Pending pending = pending_stack.pop_back_val();
+    const requite::Expression &expression = *pending._expression_ptr;
+    const std::uint32_t node_i = static_cast<std::uint32_t>(nodes.size());
+    if (pending._link_i == requite::BINARY_AST_NO_INDEX) {
+      root_i = node_i;
+    } else if (pending._is_branch_link) {
+      nodes[pending._link_i]._branch_i = node_i;
+    } else {
+      nodes[pending._link_i]._next_i = node_i;
+    }
+    requite::BinaryAstNode &node = nodes.emplace_back();
+    const requite::Opcode opcode = expression.getOpcode();
+    node._opcode = static_cast<std::uint16_t>(requite::getUnderlying(opcode));
+    node._payload = requite::BinaryAstPayload::NONE;
+    node._flags = 0;
+    node._next_i = requite::BINARY_AST_NO_INDEX;
+    node._branch_i = requite::BINARY_AST_NO_INDEX;
+    node._source_offset = requite::BINARY_AST_NO_INDEX;
+    node._source_length = 0;
+    node._payload_offset = 0;
+    node._payload_length = 0;
+    const char *source_ptr = expression.getSourceTextPtr();
+    if (source_ptr != nullptr && source_ptr >= source_text.begin() &&
+        source_ptr + expression.getSourceTextLength() <= source_text.end()) {
+      node._source_offset =
+          static_cast<std::uint32_t>(source_ptr - source_text.begin());
+      node._source_length = expression.getSourceTextLength();
+    }
+    // Only the payloads that parsing produces are stored. Symbols and the
+    // entities that later passes attach can not outlive the context.
+    if (requite::getHasTextData(opcode) && expression.getHasDataText()) {
+      const llvm::StringRef data_text = expression.getDataText();
+      node._payload = requite::BinaryAstPayload::TEXT;
+      node._payload_offset = static_cast<std::uint32_t>(text.size());
+      node._payload_length = static_cast<std::uint32_t>(data_text.size());
+      text.append(data_text.begin(), data_text.end());
+    } else if (requite::getHasIntegerData(opcode) &&
+               expression.getHasInteger()) {
+      const llvm::APSInt &integer = expression.getInteger();
+      node._payload = requite::BinaryAstPayload::INTEGER;
+      node._flags =
+          integer.isUnsigned() ? requite::BINARY_AST_FLAG_UNSIGNED : 0;
+      node._payload_offset = static_cast<std::uint32_t>(words.size());
+      node._payload_length = integer.getBitWidth();
+      words.insert(words.end(), integer.getRawData(),
+                   integer.getRawData() + integer.getNumWords());
+    }
+    if (expression.getHasNext()) {
+      pending_stack.push_back({&expression.getNext(), node_i, false});
+    }
+    if (expression.getHasBranch()) {
+      pending_stack.push_back({&expression.getBranch(), node_i, true});
+    }
+  }
+  requite::BinaryAstHeader header = {};
+  header._magic = requite::BINARY_AST_MAGIC;
+  header._version = requite::BINARY_AST_VERSION;
+  header._byte_order = requite::BINARY_AST_BYTE_ORDER;
+  header._root_i = root_i;
+  header._node_count = static_cast<std::uint32_t>(nodes.size());
+  std::uint64_t offset = sizeof(requite::BinaryAstHeader);
+  header._identifier_offset = offset;
+  header._identifier_size = identifier.size();
+  offset = requite::getBinaryAstAligned(offset + identifier.size());
+  header._source_offset = offset;
+  header._source_size = source_text.size();
+  offset = requite::getBinaryAstAligned(offset + source_text.size());
+  header._node_offset = offset;
+  offset = requite::getBinaryAstAligned(
+      offset + nodes.size() * sizeof(requite::BinaryAstNode));
+  header._text_offset = offset;
+  header._text_size = text.size();
+  offset = requite::getBinaryAstAligned(offset + text.size());
+  header._word_offset = offset;
+  header._word_count = words.size();
+  ostream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  ostream << identifier;
+  requite::writeBinaryAstPadding(ostream, identifier.size());
+  ostream << source_text;
+  requite::writeBinaryAstPadding(ostream, source_text.size());
+  ostream.write(reinterpret_cast<const char *>(nodes.data()),
+                nodes.size() * sizeof(requite::BinaryAstNode));
+  requite::writeBinaryAstPadding(ostream,
+                                 nodes.size() * sizeof(requite::BinaryAstNode));
+  ostream << text;
+  requite::writeBinaryAstPadding(ostream, text.size());
+  ostream.write(reinterpret_cast<const char *>(words.data()),
+                words.size() * sizeof(std::uint64_t));
+}
+
+BinaryAst::BinaryAst() = default;
+
+BinaryAst::BinaryAst(Self &&) = default;
+
+BinaryAst::~BinaryAst() = default;
+
+BinaryAst &BinaryAst::operator=(Self &&) = default;
+
+bool BinaryAst::read(llvm::StringRef data) {
+  // The nodes and integer words are used where they lie, so the data must be
+  // aligned as the writer laid it out. Mapped files and memory buffers are.
+  if (data.size() < sizeof(requite::BinaryAstHeader) ||
+      reinterpret_cast<std::uintptr_t>(data.data()) % 8 != 0) {
+    return false;
+  }
+  requite::BinaryAstHeader header;
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (header._magic != requite::BINARY_AST_MAGIC ||
+      header._version != requite::BINARY_AST_VERSION ||
+      header._byte_order != requite::BINARY_AST_BYTE_ORDER) {
+    return false;
+  }
+  const std::uint64_t node_size =
+      static_cast<std::uint64_t>(header._node_count) *
+      sizeof(requite::BinaryAstNode);
+  if (!requite::getIsBinaryAstSectionValid(data, header._identifier_offset,
+                                           header._identifier_size) ||
+      !requite::getIsBinaryAstSectionValid(data, header._source_offset,
+                                           header._source_size) ||
+      !requite::getIsBinaryAstSectionValid(data, header._node_offset,
+                                           node_size) ||
+      !requite::getIsBinaryAstSectionValid(data, header._text_offset,
+                                           header._text_size) ||
+      header._word_count > data.size() / sizeof(std::uint64_t) ||
+      !requite::getIsBinaryAstSectionValid(
+          data, header._word_offset,
+          header._word_count * sizeof(std::uint64_t)) ||
+      header._node_offset % alignof(requite::BinaryAstNode) != 0 ||
+      header._word_offset % alignof(std::uint64_t) != 0) {
+    return false;
+  }
+  if (header._node_count == 0 ? header._root_i != requite::BINARY_AST_NO_INDEX
+                              : header._root_i != 0) {
+    return false;
+  }
+  const llvm::StringRef source_text =
+      data.substr(header._source_offset, header._source_size);
+  const llvm::StringRef text =
+      data.substr(header._text_offset, header._text_size);
+  const llvm::ArrayRef<requite::BinaryAstNode> nodes(
+      reinterpret_cast<const requite::BinaryAstNode *>(data.data() +
+                                                       header._node_offset),
+      header._node_count);
+  const llvm::ArrayRef<std::uint64_t> words(
+      reinterpret_cast<const std::uint64_t *>(data.data() +
+                                              header._word_offset),
+      header._word_count);
+  // Every link must point forward to a node that nothing else links to, which
+  // is what makes the nodes a tree rather than a graph with cycles.
+  std::vector<bool> is_linked(nodes.size(), false);
+  const auto getIsLinkValid = [&nodes, &is_linked](std::uint32_t node_i,
+                                                   std::uint32_t link_i) {
+    if (link_i == requite::BINARY_AST_NO_INDEX) {
+      return true;
+    }
+    if (link_i <= node_i || link_i >= nodes.size() || is_linked[link_i]) {
+      return false;
+    }
+    is_linked[link_i] = true;
+    return true;
+  };
+  for (std::uint32_t node_i = 0; node_i < nodes.size(); ++node_i) {
+    const requite::BinaryAstNode &node = nodes[node_i];
+    if (node._opcode >= requite::OPCODE_COUNT ||
+        !getIsLinkValid(node_i, node._branch_i) ||
+        !getIsLinkValid(node_i, node._next_i)) {
+      return false;
+    }
+    if (node._source_offset != requite::BINARY_AST_NO_INDEX &&
+        (node._source_offset > source_text.size() ||
+         node._source_length > source_text.size() - node._source_offset)) {
+      return false;
+    }
+    const requite::Opcode opcode = static_cast<requite::Opcode>(node._opcode);
+    switch (node._payload) {
+    case requite::BinaryAstPayload::NONE:
+      break;
+    case requite::BinaryAstPayload::TEXT:
+      if (!requite::getHasTextData(opcode) ||
+          node._payload_offset > text.size() ||
+          node._payload_length > text.size() - node._payload_offset) {
+        return false;
+      }
+      break;
+    case requite::BinaryAstPayload::INTEGER: {
+      const std::uint64_t word_count =
+          llvm::divideCeil(node._payload_length, 64);
+      if (!requite::getHasIntegerData(opcode) || node._payload_length == 0 ||
+          node._payload_offset > words.size() ||
+          word_count > words.size() - node._payload_offset) {
+        return false;
+      }
+    } break;
+    default:
+      return false;
+    }
+  }
+  // All of the expressions share one allocation. Their text is not copied.
+  std::unique_ptr<requite::Expression[]> expressions_uptr =
+      std::make_unique<requite::Expression[]>(nodes.size());
+  for (std::uint32_t node_i = 0; node_i < nodes.size(); ++node_i) {
+    const requite::BinaryAstNode &node = nodes[node_i];
+    requite::Expression &expression = expressions_uptr[node_i];
+    expression._is_in_array = true;
+    expression._opcode = static_cast<requite::Opcode>(node._opcode);
+    if (node._next_i != requite::BINARY_AST_NO_INDEX) {
+      expression._next_ptr = &expressions_uptr[node._next_i];
+    }
+    if (node._branch_i != requite::BINARY_AST_NO_INDEX) {
+      expression._branch_ptr = &expressions_uptr[node._branch_i];
+    }
+    if (node._source_offset != requite::BINARY_AST_NO_INDEX) {
+      expression._source_text_ptr = source_text.data() + node._source_offset;
+      expression._source_text_length = node._source_length;
+    }
+    switch (node._payload) {
+    case requite::BinaryAstPayload::NONE:
+      break;
+    case requite::BinaryAstPayload::TEXT:
+      expression._data.emplace<llvm::StringRef>(
+          text.substr(node._payload_offset, node._payload_length));
+      break;
+    case requite::BinaryAstPayload::INTEGER:
+      expression._data.emplace<llvm::APSInt>(
+          llvm::APInt(node._payload_length,
+                      words.slice(node._payload_offset,
+                                  llvm::divideCeil(node._payload_length, 64))),
+          (node._flags & requite::BINARY_AST_FLAG_UNSIGNED) != 0);
+      break;
+    }
+  }
+  this->_expressions_uptr = std::move(expressions_uptr);
+  this->_root_ptr =
+      nodes.empty() ? nullptr : &this->_expressions_uptr[header._root_i];
+  this->_identifier =
+      data.substr(header._identifier_offset, header._identifier_size);
+  this->_source_text = source_text;
+  return true;
+}
+
+bool BinaryAst::getHasExpression() const { return this->_root_ptr != nullptr; }
+
+requite::Expression &BinaryAst::getExpression() {
+  return requite::getRef(this->_root_ptr);
+}
+
+const requite::Expression &BinaryAst::getExpression() const {
+  return requite::getRef(this->_root_ptr);
+}
+
+llvm::StringRef BinaryAst::getIdentifier() const { return this->_identifier; }
+
+llvm::StringRef BinaryAst::getSourceText() const { return this->_source_text; }
+
+bool Context::writeBinaryAst(const requite::Module &module,
+                             llvm::StringRef out_path) {
+  std::error_code ec;
+  llvm::raw_fd_ostream fout(out_path, ec, llvm::sys::fs::OF_None);
+  if (ec) {
+    this->logMessage(
+        requite::LogType::ERROR, "open-output-file-failed",
+        llvm::Twine("failed to open output file for writing\n\tpath: ") +
+        llvm::Twine(out_path) + llvm::Twine("\n\treason: ") +
+        llvm::Twine(ec.message()));
+    return false;
+  }
+  requite::writeBinaryAst(
+      module.getHasExpression() ? &module.getExpression() : nullptr,
+      module.getIdentifier(), module.getText(), fout);
+  fout.close();
+  if (fout.has_error()) {
+    this->logMessage(
+        requite::LogType::ERROR, "write-output-file-failed",
+        llvm::Twine("failed to write output file\n\tpath: ") +
+        llvm::Twine(out_path) + llvm::Twine("\n\treason: ") +
+        llvm::Twine(fout.error().message()));
+    fout.clear_error();
+    return false;
+  }
+  return true;
+}
+
+bool Context::readBinaryAst(requite::Module &module, llvm::StringRef path) {
+  REQUITE_ASSERT(!module.getHasExpression());
+  // Large files are mapped rather than read, and the module keeps the mapping
+  // alive for as long as the text of its expressions refers to it.
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer_eo =
+      llvm::MemoryBuffer::getFile(path, false, false);
+  if (!buffer_eo) {
+    this->logMessage(
+        requite::LogType::ERROR, "read-binary-ast-failed",
+        llvm::Twine("failed to read binary ast file\n\tpath: ") +
+        llvm::Twine(path) + llvm::Twine("\n\treason: ") +
+        llvm::Twine(buffer_eo.getError().message()));
+    return false;
+  }
+  std::unique_ptr<llvm::MemoryBuffer> &buffer_uptr = buffer_eo.get();
+  requite::BinaryAst binary_ast;
+  if (!binary_ast.read(buffer_uptr->getBuffer())) {
+    this->logMessage(
+        requite::LogType::ERROR, "invalid-binary-ast",
+        llvm::Twine("file is not a valid binary ast\n\tpath: ") +
+        llvm::Twine(path));
+    return false;
+  }
+  std::unique_ptr<llvm::MemoryBuffer> source_buffer_uptr =
+      llvm::MemoryBuffer::getMemBuffer(binary_ast.getSourceText(),
+                                       binary_ast.getIdentifier(), false);
+  requite::File &file = module.getFile();
+  file._path = binary_ast.getIdentifier().str();
+  file._buffer_ref = source_buffer_uptr->getMemBufferRef();
+  file._buffer_i = this->_source_mgr.AddNewSourceBuffer(
+      std::move(source_buffer_uptr), llvm::SMLoc());
+  // The module owns the expression array, and deleting an expression in it
+  // leaves it to be freed along with the module.
+  if (binary_ast.getHasExpression()) {
+    module.setExpression(binary_ast.getExpression());
+  }
+  module._binary_ast_expressions_uptr = std::move(binary_ast._expressions_uptr);
+  module._binary_ast_buffer_uptr = std::move(buffer_uptr);
+  return true;
+}
+
+} // namespace requite
@@ -6,6 +6,11 @@
 namespace requite {
 
 bool Context::buildIr() {
+  // Procedures are built one after another on the context's IRBuilder. The
+  // only procedures are entry points, a module may have one, and it is
+  // mangled "main", so there is nothing to build in parallel yet. Building
+  // per procedure shards on their own llvm contexts and linking them in order
+  // can wait for procedures with unique symbols.
   requite::Builder builder(*this);
   bool is_ok = true;
   requite::Module &source_module = this->getSourceModule();
@@ -80,6 +85,16 @@ llvm::Type *Builder::makeLlvmType(const requite::Symbol &type) {
   return llvm_type;
 }
 
+llvm::Type *Builder::getLlvmType(requite::TypeHandle type) {
+  // Interned types are unique, so the handle identifies the llvm type and it
+  // only has to be made once per builder.
+  llvm::Type *&llvm_type = this->_llvm_type_map[&type.getSymbol()];
+  if (llvm_type == nullptr) {
+    llvm_type = this->makeLlvmType(type.getSymbol());
+  }
+  return llvm_type;
+}
+
 void Builder::buildAssignment(llvm::Value *llvm_value,
                               llvm::AllocaInst *llvm_alloca) {
   this->getContext().getLlvmBuilder().CreateStore(
@@ -91,8 +106,9 @@ void Builder::buildAssignment(llvm::Value *llvm_value,
 bool Builder::buildStatement_Local(requite::Expression &statement) {
   REQUITE_ASSERT(statement.getOpcode() == requite::Opcode::_LOCAL);
   requite::OrderedVariable &local = statement.getOrderedVariable();
-  requite::Symbol &type = local.getDataType();
-  llvm::Type *llvm_type = this->makeLlvmType(type);
+  const requite::TypeHandle interned_type = local.getInternedDataType();
+  const requite::Symbol &type = interned_type.getSymbol();
+  llvm::Type *llvm_type = this->getLlvmType(interned_type);
   llvm::AllocaInst *llvm_alloca =
       this->buildLlvmAlloca(llvm_type, local.getName());
   local.setLlvmAllocaPtr(llvm_alloca);
@@ -145,13 +161,23 @@ llvm::Value *
 Builder::buildValue__IntegerLiteral(requite::Expression &expression,
                                     const requite::Symbol &expected_type) {
   REQUITE_ASSERT(expression.getOpcode() == requite::Opcode::__INTEGER_LITERAL);
-  // TODO: check expected type
-  // TODO: load integer of expected type size using APInt
-  unsigned integer;
-  requite::NumericResult result =
-      requite::getNumericValue(expression.getSourceText(), integer);
-  llvm::Value *value = this->getContext().getLlvmBuilder().getInt32(integer);
-  return value;
+  if (!expected_type.getIsInteger()) {
+    this->getContext().logErrorInvalidExpectedTypeForOperation(expression,
+                                                               expected_type);
+    return nullptr;
+  }
+  const requite::RootSymbol &root = expected_type.getRoot();
+  llvm::APSInt integer;
+  if (!requite::getFittedInteger(
+          expression.getInteger(), root.getDepth(),
+          root.getType() == requite::RootSymbolType::UNSIGNED_INTEGER,
+          integer)) {
+    this->getContext().logIdentifiedSourceMessage(
+        expression, requite::LogType::ERROR, "integer-literal-out-of-range",
+        "integer literal does not fit in expected type");
+    return nullptr;
+  }
+  return llvm::ConstantInt::get(this->getContext().getLlvmContext(), integer);
 }
 
 llvm::Value *Builder::buildValue_Add(requite::Expression &expression,
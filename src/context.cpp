@@ -4,10 +4,19 @@
 
 #include <requite/context.hpp>
 
+#include <atomic>
+#include <cstdint>
+
 namespace requite {
 
+[[nodiscard]] static std::uint64_t getNextSymbolPoolsId() {
+  static std::atomic<std::uint64_t> next_id = 1;
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
 Context::Context(std::string &&executable_path)
-    : _executable_path(std::move(executable_path)) {}
+    : _executable_path(std::move(executable_path)),
+      _symbol_pools_id(requite::getNextSymbolPoolsId()) {}
 
 llvm::StringRef Context::getExecutablePath() const {
   REQUITE_ASSERT(!this->_executable_path.empty());
@@ -14,129 +14,21 @@ bool Context::contextualizeModule(requite::Module &module) {
   REQUITE_ASSERT(module_name.getOpcode() ==
                  requite::Opcode::__IDENTIFIER_LITERAL);
   bool is_ok = true;
-  for (requite::Expression &expression : module_name.getNextSubrange()) {
-    switch (const requite::Opcode opcode = expression.getOpcode()) {
-    case requite::Opcode::_ASCRIBE_FIRST_BRANCH: {
-      requite::Expression &ascribed = expression.getBranch();
-      switch (const requite::Opcode ascribed_opcode = ascribed.getOpcode()) {
-      case requite::Opcode::ENTRY_POINT:
-        this->logErrorMustNotHaveAttributeFlags(ascribed);
+  if (!module.getIsTabulated()) {
+    for (requite::Expression &expression : module_name.getNextSubrange()) {
+      if (!this->tabulateModuleStatement(module, expression)) {
         is_ok = false;
-        break;
-      case requite::Opcode::FUNCTION:
-        this->logNotSupportedYet(expression);
-        is_ok = false;
-        break;
-      case requite::Opcode::GLOBAL:
-        this->logNotSupportedYet(expression);
-        is_ok = false;
-        break;
-      case requite::Opcode::OBJECT:
-        this->logNotSupportedYet(expression);
-        is_ok = false;
-        break;
-      case requite::Opcode::TABLE:
-        this->logNotSupportedYet(expression);
-        is_ok = false;
-        break;
-      case requite::Opcode::IMPORT:
-        this->logNotSupportedYet(expression);
-        is_ok = false;
-        break;
-      case requite::Opcode::USE:
-        this->logNotSupportedYet(expression);
-        is_ok = false;
-        break;
-      case requite::Opcode::_EXPAND_VALUE:
-        this->logNotSupportedYet(expression);
-        is_ok = false;
-        break;
-      default:
-        REQUITE_UNREACHABLE();
       }
-      break;
     }
-    case requite::Opcode::ENTRY_POINT:
-      if (!this->tabulateEntryPoint(module, expression)) {
-        is_ok = false;
-      }
-      break;
-    case requite::Opcode::FUNCTION:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::GLOBAL:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::OBJECT:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::TABLE:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::IMPORT:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::USE:
-      this->logNotSupportedYet(expression);
+    if (!this->tabulateProcedures(module)) {
       is_ok = false;
-      break;
-    case requite::Opcode::_EXPAND_VALUE:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    default:
-      REQUITE_UNREACHABLE();
     }
-  }
-  if (!is_ok) {
-    return false;
-  }
-  for (requite::Expression &expression : module_name.getNextSubrange()) {
-    switch (const requite::Opcode opcode = expression.getOpcode()) {
-    case requite::Opcode::ENTRY_POINT:
-      if (!this->prototypeEntryPoint(expression.getProcedure())) {
-        is_ok = false;
-      }
-      break;
-    case requite::Opcode::FUNCTION:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::GLOBAL:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::OBJECT:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::TABLE:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::IMPORT:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::USE:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    case requite::Opcode::_EXPAND_VALUE:
-      this->logNotSupportedYet(expression);
-      is_ok = false;
-      break;
-    default:
-      REQUITE_UNREACHABLE();
+    if (!is_ok) {
+      return false;
     }
+    module.setIsTabulated();
   }
-
-  return is_ok;
+  return this->prototypeProcedures(module);
 }
 
 bool Context::checkEntryPointCount() {
@@ -149,8 +41,9 @@ bool Context::checkEntryPointCount() {
     return true;
   }
   for (requite::Procedure &overload : entry_point.getOverloadSubrange()) {
-    this->logSourceMessage(overload.getExpression(), requite::LogType::ERROR,
-                           "multiple entry points in module.");
+    this->logIdentifiedSourceMessage(
+        overload.getExpression(), requite::LogType::ERROR,
+        "multiple-entry-points", "multiple entry points in module.");
   }
   return false;
 }
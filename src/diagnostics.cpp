@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include <requite/assert.hpp>
+#include <requite/diagnostics.hpp>
+#include <requite/utility.hpp>
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+namespace requite {
+
+requite::LogType Diagnostic::getType() const { return this->_type; }
+
+bool Diagnostic::getHasLocation() const { return this->_location.isValid(); }
+
+llvm::SMLoc Diagnostic::getLocation() const { return this->_location; }
+
+bool Diagnostic::getHasFilename() const { return !this->_filename.empty(); }
+
+llvm::StringRef Diagnostic::getFilename() const { return this->_filename; }
+
+llvm::StringRef Diagnostic::getMessage() const { return this->_message; }
+
+bool Diagnostic::getHasId() const { return !this->_id.empty(); }
+
+llvm::StringRef Diagnostic::getId() const { return this->_id; }
+
+bool Diagnostic::getHasOpcode() const {
+  return this->_opcode != requite::Opcode::__NONE;
+}
+
+requite::Opcode Diagnostic::getOpcode() const { return this->_opcode; }
+
+llvm::ArrayRef<llvm::SMRange> Diagnostic::getRanges() const {
+  return this->_ranges;
+}
+
+llvm::ArrayRef<llvm::SMFixIt> Diagnostic::getFixits() const {
+  return this->_fixits;
+}
+
+void Diagnostic::render(const llvm::SourceMgr &source_mgr,
+                        llvm::raw_ostream &ostream) const {
+  const auto kind = static_cast<llvm::SourceMgr::DiagKind>(this->getType());
+  if (this->getHasLocation()) {
+    source_mgr.PrintMessage(ostream, this->getLocation(), kind,
+                            this->getMessage(), this->getRanges(),
+                            this->getFixits(), true);
+    return;
+  }
+  // Without a filename only the kind label is printed before the message.
+  source_mgr.PrintMessage(
+      ostream,
+      llvm::SMDiagnostic(this->getFilename(), kind, this->getMessage()));
+}
+
+[[nodiscard]] static std::uint64_t getNextDiagnosticsId() {
+  static std::atomic<std::uint64_t> next_id = 1;
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+Diagnostics::Diagnostics() : _id(requite::getNextDiagnosticsId()) {}
+
+void Diagnostics::setErrorLimit(unsigned limit) { this->_error_limit = limit; }
+
+unsigned Diagnostics::getErrorLimit() const { return this->_error_limit; }
+
+unsigned Diagnostics::getErrorCount() const {
+  return this->_error_count.load(std::memory_order_relaxed);
+}
+
+bool Diagnostics::getIsErrorLimitReached() const {
+  return this->getErrorLimit() != Self::NO_ERROR_LIMIT &&
+         this->getErrorCount() >= this->getErrorLimit();
+}
+
+bool Diagnostics::getHasDroppedErrors() const {
+  return this->getErrorLimit() != Self::NO_ERROR_LIMIT &&
+         this->getErrorCount() > this->getErrorLimit();
+}
+
+void Diagnostics::report(requite::Diagnostic &&diagnostic) {
+  // Every diagnostic is kept until gather, which applies the error limit in
+  // source order. The count only tells passes when to stop.
+  if (diagnostic.getType() == requite::LogType::ERROR) {
+    this->_error_count.fetch_add(1, std::memory_order_relaxed);
+  }
+  this->getThreadBuffer()._diagnostics.push_back(std::move(diagnostic));
+}
+
+requite::DiagnosticBuffer &Diagnostics::getThreadBuffer() {
+  // Each thread remembers the buffer it last used so that reporting only
+  // locks the first time a thread reports to this engine. The engine is keyed
+  // by a unique id rather than its address, which a later engine may reuse.
+  thread_local std::uint64_t cached_id = 0;
+  thread_local requite::DiagnosticBuffer *cached_buffer_ptr = nullptr;
+  if (cached_id == this->_id) {
+    return requite::getRef(cached_buffer_ptr);
+  }
+  std::scoped_lock guard(this->_buffer_mutex);
+  cached_buffer_ptr = this->_buffer_uptrs
+                          .emplace_back(
+                              std::make_unique<requite::DiagnosticBuffer>())
+                          .get();
+  cached_id = this->_id;
+  return requite::getRef(cached_buffer_ptr);
+}
+
+void Diagnostics::gather(std::vector<requite::Diagnostic> &out_diagnostics,
+                         const llvm::SourceMgr &source_mgr) {
+  struct Key final {
+    unsigned _buffer_id;
+    std::size_t _offset;
+    requite::Diagnostic *_diagnostic_ptr;
+  };
+  std::scoped_lock guard(this->_buffer_mutex);
+  std::vector<Key> keys;
+  for (std::unique_ptr<requite::DiagnosticBuffer> &buffer_uptr :
+       this->_buffer_uptrs) {
+    std::vector<requite::Diagnostic> &diagnostics = buffer_uptr->_diagnostics;
+    for (requite::Diagnostic &diagnostic : diagnostics) {
+      Key &key = keys.emplace_back();
+      key._buffer_id = 0;
+      key._offset = 0;
+      key._diagnostic_ptr = &diagnostic;
+      if (diagnostic.getHasLocation()) {
+        key._buffer_id =
+            source_mgr.FindBufferContainingLoc(diagnostic.getLocation());
+        if (key._buffer_id != 0) {
+          key._offset = static_cast<std::size_t>(
+              diagnostic.getLocation().getPointer() -
+              source_mgr.getMemoryBuffer(key._buffer_id)->getBufferStart());
+        }
+      }
+    }
+  }
+  // Diagnostics are ordered by where they occur and then by their text, which
+  // does not depend on which thread reported them. The sort is stable so that
+  // identical diagnostics from one thread keep the order they were reported.
+  std::stable_sort(
+      keys.begin(), keys.end(), [](const Key &lhs, const Key &rhs) {
+        const requite::Diagnostic &lhs_diagnostic = *lhs._diagnostic_ptr;
+        const requite::Diagnostic &rhs_diagnostic = *rhs._diagnostic_ptr;
+        return std::make_tuple(lhs._buffer_id, lhs._offset,
+                               lhs_diagnostic.getType(),
+                               lhs_diagnostic.getFilename(),
+                               lhs_diagnostic.getMessage()) <
+               std::make_tuple(rhs._buffer_id, rhs._offset,
+                               rhs_diagnostic.getType(),
+                               rhs_diagnostic.getFilename(),
+                               rhs_diagnostic.getMessage());
+      });
+  // The limit keeps the errors that come first in the source, not the ones
+  // that happened to be reported first. Everything from the first error past
+  // the limit on is dropped, so no note is left after the error it was for.
+  out_diagnostics.reserve(out_diagnostics.size() + keys.size());
+  unsigned error_count = 0;
+  for (const Key &key : keys) {
+    requite::Diagnostic &diagnostic = *key._diagnostic_ptr;
+    if (diagnostic.getType() == requite::LogType::ERROR) {
+      ++error_count;
+      if (this->getErrorLimit() != Self::NO_ERROR_LIMIT &&
+          error_count > this->getErrorLimit()) {
+        break;
+      }
+    }
+    out_diagnostics.push_back(std::move(diagnostic));
+  }
+  for (std::unique_ptr<requite::DiagnosticBuffer> &buffer_uptr :
+       this->_buffer_uptrs) {
+    buffer_uptr->_diagnostics.clear();
+  }
+}
+
+void Diagnostics::render(const llvm::SourceMgr &source_mgr,
+                         llvm::raw_ostream &ostream) {
+  std::vector<requite::Diagnostic> diagnostics;
+  this->gather(diagnostics, source_mgr);
+  for (const requite::Diagnostic &diagnostic : diagnostics) {
+    diagnostic.render(source_mgr, ostream);
+  }
+  if (this->getHasDroppedErrors()) {
+    ostream << "error: stopped after " << this->getErrorLimit()
+            << " errors. use --error-limit=0 to show every error.\n";
+  }
+  ostream.flush();
+}
+
+} // namespace requite
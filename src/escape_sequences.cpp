@@ -8,12 +8,220 @@
 
 #include <llvm/ADT/SmallString.h>
 
+#include <algorithm>
+#include <iterator>
+
 namespace requite {
 
+struct CommonCodepointName final {
+  llvm::StringRef _name;
+  std::uint32_t _codepoint;
+};
+
+// The names most often written in escapes, sorted by name so that they are
+// found with a binary search before falling back to ICU's name data.
+static constexpr requite::CommonCodepointName COMMON_CODEPOINT_NAMES[] = {
+    {"ALMOST EQUAL TO", 0x2248},
+    {"AMPERSAND", 0x0026},
+    {"APOSTROPHE", 0x0027},
+    {"ASTERISK", 0x002A},
+    {"BALLOT X", 0x2717},
+    {"BLACK CIRCLE", 0x25CF},
+    {"BLACK SQUARE", 0x25A0},
+    {"BLACK STAR", 0x2605},
+    {"BOX DRAWINGS LIGHT DOWN AND LEFT", 0x2510},
+    {"BOX DRAWINGS LIGHT DOWN AND RIGHT", 0x250C},
+    {"BOX DRAWINGS LIGHT HORIZONTAL", 0x2500},
+    {"BOX DRAWINGS LIGHT UP AND LEFT", 0x2518},
+    {"BOX DRAWINGS LIGHT UP AND RIGHT", 0x2514},
+    {"BOX DRAWINGS LIGHT VERTICAL", 0x2502},
+    {"BULLET", 0x2022},
+    {"CHECK MARK", 0x2713},
+    {"CIRCUMFLEX ACCENT", 0x005E},
+    {"COLON", 0x003A},
+    {"COMMA", 0x002C},
+    {"COMMERCIAL AT", 0x0040},
+    {"COPYRIGHT SIGN", 0x00A9},
+    {"DAGGER", 0x2020},
+    {"DEGREE SIGN", 0x00B0},
+    {"DIGIT EIGHT", 0x0038},
+    {"DIGIT FIVE", 0x0035},
+    {"DIGIT FOUR", 0x0034},
+    {"DIGIT NINE", 0x0039},
+    {"DIGIT ONE", 0x0031},
+    {"DIGIT SEVEN", 0x0037},
+    {"DIGIT SIX", 0x0036},
+    {"DIGIT THREE", 0x0033},
+    {"DIGIT TWO", 0x0032},
+    {"DIGIT ZERO", 0x0030},
+    {"DIVISION SIGN", 0x00F7},
+    {"DOLLAR SIGN", 0x0024},
+    {"DOWNWARDS ARROW", 0x2193},
+    {"ELEMENT OF", 0x2208},
+    {"EM DASH", 0x2014},
+    {"EN DASH", 0x2013},
+    {"EQUALS SIGN", 0x003D},
+    {"EURO SIGN", 0x20AC},
+    {"EXCLAMATION MARK", 0x0021},
+    {"FACE WITH TEARS OF JOY", 0x1F602},
+    {"FOR ALL", 0x2200},
+    {"FULL STOP", 0x002E},
+    {"GRAVE ACCENT", 0x0060},
+    {"GREATER-THAN OR EQUAL TO", 0x2265},
+    {"GREATER-THAN SIGN", 0x003E},
+    {"GREEK CAPITAL LETTER DELTA", 0x0394},
+    {"GREEK CAPITAL LETTER OMEGA", 0x03A9},
+    {"GREEK CAPITAL LETTER SIGMA", 0x03A3},
+    {"GREEK SMALL LETTER ALPHA", 0x03B1},
+    {"GREEK SMALL LETTER BETA", 0x03B2},
+    {"GREEK SMALL LETTER DELTA", 0x03B4},
+    {"GREEK SMALL LETTER EPSILON", 0x03B5},
+    {"GREEK SMALL LETTER GAMMA", 0x03B3},
+    {"GREEK SMALL LETTER LAMDA", 0x03BB},
+    {"GREEK SMALL LETTER MU", 0x03BC},
+    {"GREEK SMALL LETTER OMEGA", 0x03C9},
+    {"GREEK SMALL LETTER PHI", 0x03C6},
+    {"GREEK SMALL LETTER PI", 0x03C0},
+    {"GREEK SMALL LETTER SIGMA", 0x03C3},
+    {"GREEK SMALL LETTER TAU", 0x03C4},
+    {"GREEK SMALL LETTER THETA", 0x03B8},
+    {"GRINNING FACE", 0x1F600},
+    {"HEAVY BLACK HEART", 0x2764},
+    {"HORIZONTAL ELLIPSIS", 0x2026},
+    {"HYPHEN-MINUS", 0x002D},
+    {"IDENTICAL TO", 0x2261},
+    {"INFINITY", 0x221E},
+    {"INTERSECTION", 0x2229},
+    {"LATIN CAPITAL LETTER A", 0x0041},
+    {"LATIN CAPITAL LETTER B", 0x0042},
+    {"LATIN CAPITAL LETTER C", 0x0043},
+    {"LATIN CAPITAL LETTER D", 0x0044},
+    {"LATIN CAPITAL LETTER E", 0x0045},
+    {"LATIN CAPITAL LETTER F", 0x0046},
+    {"LATIN CAPITAL LETTER G", 0x0047},
+    {"LATIN CAPITAL LETTER H", 0x0048},
+    {"LATIN CAPITAL LETTER I", 0x0049},
+    {"LATIN CAPITAL LETTER J", 0x004A},
+    {"LATIN CAPITAL LETTER K", 0x004B},
+    {"LATIN CAPITAL LETTER L", 0x004C},
+    {"LATIN CAPITAL LETTER M", 0x004D},
+    {"LATIN CAPITAL LETTER N", 0x004E},
+    {"LATIN CAPITAL LETTER O", 0x004F},
+    {"LATIN CAPITAL LETTER P", 0x0050},
+    {"LATIN CAPITAL LETTER Q", 0x0051},
+    {"LATIN CAPITAL LETTER R", 0x0052},
+    {"LATIN CAPITAL LETTER S", 0x0053},
+    {"LATIN CAPITAL LETTER T", 0x0054},
+    {"LATIN CAPITAL LETTER U", 0x0055},
+    {"LATIN CAPITAL LETTER V", 0x0056},
+    {"LATIN CAPITAL LETTER W", 0x0057},
+    {"LATIN CAPITAL LETTER X", 0x0058},
+    {"LATIN CAPITAL LETTER Y", 0x0059},
+    {"LATIN CAPITAL LETTER Z", 0x005A},
+    {"LATIN SMALL LETTER A", 0x0061},
+    {"LATIN SMALL LETTER B", 0x0062},
+    {"LATIN SMALL LETTER C", 0x0063},
+    {"LATIN SMALL LETTER D", 0x0064},
+    {"LATIN SMALL LETTER E", 0x0065},
+    {"LATIN SMALL LETTER F", 0x0066},
+    {"LATIN SMALL LETTER G", 0x0067},
+    {"LATIN SMALL LETTER H", 0x0068},
+    {"LATIN SMALL LETTER I", 0x0069},
+    {"LATIN SMALL LETTER J", 0x006A},
+    {"LATIN SMALL LETTER K", 0x006B},
+    {"LATIN SMALL LETTER L", 0x006C},
+    {"LATIN SMALL LETTER M", 0x006D},
+    {"LATIN SMALL LETTER N", 0x006E},
+    {"LATIN SMALL LETTER O", 0x006F},
+    {"LATIN SMALL LETTER P", 0x0070},
+    {"LATIN SMALL LETTER Q", 0x0071},
+    {"LATIN SMALL LETTER R", 0x0072},
+    {"LATIN SMALL LETTER S", 0x0073},
+    {"LATIN SMALL LETTER T", 0x0074},
+    {"LATIN SMALL LETTER U", 0x0075},
+    {"LATIN SMALL LETTER V", 0x0076},
+    {"LATIN SMALL LETTER W", 0x0077},
+    {"LATIN SMALL LETTER X", 0x0078},
+    {"LATIN SMALL LETTER Y", 0x0079},
+    {"LATIN SMALL LETTER Z", 0x007A},
+    {"LEFT CURLY BRACKET", 0x007B},
+    {"LEFT DOUBLE QUOTATION MARK", 0x201C},
+    {"LEFT PARENTHESIS", 0x0028},
+    {"LEFT SINGLE QUOTATION MARK", 0x2018},
+    {"LEFT SQUARE BRACKET", 0x005B},
+    {"LEFT-POINTING DOUBLE ANGLE QUOTATION MARK", 0x00AB},
+    {"LEFTWARDS ARROW", 0x2190},
+    {"LESS-THAN OR EQUAL TO", 0x2264},
+    {"LESS-THAN SIGN", 0x003C},
+    {"LOGICAL AND", 0x2227},
+    {"LOGICAL OR", 0x2228},
+    {"LOW LINE", 0x005F},
+    {"MICRO SIGN", 0x00B5},
+    {"MIDDLE DOT", 0x00B7},
+    {"MULTIPLICATION SIGN", 0x00D7},
+    {"N-ARY SUMMATION", 0x2211},
+    {"NO-BREAK SPACE", 0x00A0},
+    {"NOT EQUAL TO", 0x2260},
+    {"NUMBER SIGN", 0x0023},
+    {"PER MILLE SIGN", 0x2030},
+    {"PERCENT SIGN", 0x0025},
+    {"PILCROW SIGN", 0x00B6},
+    {"PLUS SIGN", 0x002B},
+    {"PLUS-MINUS SIGN", 0x00B1},
+    {"POUND SIGN", 0x00A3},
+    {"QUESTION MARK", 0x003F},
+    {"QUOTATION MARK", 0x0022},
+    {"REGISTERED SIGN", 0x00AE},
+    {"REPLACEMENT CHARACTER", 0xFFFD},
+    {"REVERSE SOLIDUS", 0x005C},
+    {"RIGHT CURLY BRACKET", 0x007D},
+    {"RIGHT DOUBLE QUOTATION MARK", 0x201D},
+    {"RIGHT PARENTHESIS", 0x0029},
+    {"RIGHT SINGLE QUOTATION MARK", 0x2019},
+    {"RIGHT SQUARE BRACKET", 0x005D},
+    {"RIGHT-POINTING DOUBLE ANGLE QUOTATION MARK", 0x00BB},
+    {"RIGHTWARDS ARROW", 0x2192},
+    {"RIGHTWARDS DOUBLE ARROW", 0x21D2},
+    {"SECTION SIGN", 0x00A7},
+    {"SEMICOLON", 0x003B},
+    {"SOLIDUS", 0x002F},
+    {"SPACE", 0x0020},
+    {"SQUARE ROOT", 0x221A},
+    {"THERE EXISTS", 0x2203},
+    {"THUMBS UP SIGN", 0x1F44D},
+    {"TILDE", 0x007E},
+    {"TRADE MARK SIGN", 0x2122},
+    {"UNION", 0x222A},
+    {"UPWARDS ARROW", 0x2191},
+    {"VERTICAL LINE", 0x007C},
+    {"YEN SIGN", 0x00A5},
+    {"ZERO WIDTH JOINER", 0x200D},
+    {"ZERO WIDTH NO-BREAK SPACE", 0xFEFF},
+    {"ZERO WIDTH NON-JOINER", 0x200C},
+    {"ZERO WIDTH SPACE", 0x200B},
+};
+
+[[nodiscard]] static std::optional<std::uint32_t>
+getCommonUtf32FromName(llvm::StringRef text) {
+  const auto found = std::lower_bound(
+      std::begin(COMMON_CODEPOINT_NAMES), std::end(COMMON_CODEPOINT_NAMES),
+      text, [](const requite::CommonCodepointName &entry, llvm::StringRef text) {
+        return entry._name < text;
+      });
+  if (found == std::end(COMMON_CODEPOINT_NAMES) || found->_name != text) {
+    return std::nullopt;
+  }
+  return found->_codepoint;
+}
+
 std::optional<std::uint32_t> getUtf32FromName(llvm::StringRef text) {
   if (text.empty()) {
     return std::nullopt;
   }
+  if (std::optional<std::uint32_t> common =
+          requite::getCommonUtf32FromName(text)) {
+    return common;
+  }
   llvm::SmallString<64> buffer = text;
   UErrorCode error_code = U_ZERO_ERROR;
   UChar32 utf32_codepoint =
@@ -25,4 +233,4 @@ std::optional<std::uint32_t> getUtf32FromName(llvm::StringRef text) {
   return static_cast<std::uint32_t>(utf32_codepoint);
 }
 
-} // namespace requite
\ No newline at end of file
+} // namespace requite
@@ -1,27 +1,457 @@
+#include <requite/assert.hpp>
 #include <requite/context.hpp>
 #include <requite/numeric.hpp>
+#include <requite/unreachable.hpp>
+
+#include <llvm/ADT/APFloat.h>
+#include <llvm/ADT/APSInt.h>
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+
+#include <limits>
+#include <utility>
 
 namespace requite {
 
-bool Context::evaluateConstantUnsigned(unsigned& out_unsigned, requite::Scope& scope, requite::Expression &value_expression) {
-    switch (const requite::Opcode opcode = value_expression.getOpcode()) {
-        case requite::Opcode::__INTEGER_LITERAL: {
-            requite::NumericResult result =
-                requite::getNumericValue(value_expression.getSourceText(), out_unsigned);
-            if (result != requite::NumericResult::OK) {
-                return false;
-            }
-        } return true;      
-        case requite::Opcode::ADDRESS_DEPTH: {
-            out_unsigned = this->getAddressDepth();
-        } return true;
-        case requite::Opcode::ADDRESS_SIZE: {
-            out_unsigned = this->getAddressSize();
-        } return true;
-        default:
-            break;
+[[nodiscard]] static llvm::APSInt makeConstantBoolean(bool value) {
+  return llvm::APSInt(llvm::APInt(1, value ? 1 : 0), true);
+}
+
+[[nodiscard]] static bool getIsSameIntegerType(const llvm::APSInt &lhs,
+                                               const llvm::APSInt &rhs) {
+  return lhs.getBitWidth() == rhs.getBitWidth() &&
+         lhs.isSigned() == rhs.isSigned();
+}
+
+[[nodiscard]] static bool
+getIsSignedDivisionOverflow(const llvm::APSInt &lhs, const llvm::APSInt &rhs) {
+  return lhs.isSigned() && lhs.isMinSignedValue() && rhs.isAllOnes();
+}
+
+[[nodiscard]] static bool
+applyConstantIntegerOperation(llvm::APSInt &lhs, requite::Opcode opcode,
+                              const llvm::APSInt &rhs) {
+  if (!requite::getIsSameIntegerType(lhs, rhs)) {
+    return false;
+  }
+  // Operations that are undefined at runtime are left unfolded so that they
+  // behave the same as the emitted instruction would.
+  switch (opcode) {
+  case requite::Opcode::_ADD:
+    lhs += rhs;
+    return true;
+  case requite::Opcode::_SUBTRACT:
+    lhs -= rhs;
+    return true;
+  case requite::Opcode::_MULTIPLY:
+    lhs *= rhs;
+    return true;
+  case requite::Opcode::_DIVIDE:
+    if (rhs.isZero() || requite::getIsSignedDivisionOverflow(lhs, rhs)) {
+      return false;
+    }
+    lhs /= rhs;
+    return true;
+  case requite::Opcode::_MODULUS:
+    if (rhs.isZero() || requite::getIsSignedDivisionOverflow(lhs, rhs)) {
+      return false;
+    }
+    lhs %= rhs;
+    return true;
+  case requite::Opcode::_BITWISE_OR:
+    lhs |= rhs;
+    return true;
+  case requite::Opcode::_BITWISE_AND:
+    lhs &= rhs;
+    return true;
+  case requite::Opcode::_BITWISE_XOR:
+    lhs ^= rhs;
+    return true;
+  case requite::Opcode::_BITWISE_SHIFT_LEFT:
+    if (rhs.isNegative() || rhs.uge(lhs.getBitWidth())) {
+      return false;
+    }
+    lhs <<= static_cast<unsigned>(rhs.getZExtValue());
+    return true;
+  case requite::Opcode::_BITWISE_SHIFT_RIGHT:
+    if (rhs.isNegative() || rhs.uge(lhs.getBitWidth())) {
+      return false;
+    }
+    lhs >>= static_cast<unsigned>(rhs.getZExtValue());
+    return true;
+  case requite::Opcode::_BITWISE_ROTATE_LEFT:
+    lhs = llvm::APSInt(lhs.rotl(rhs), lhs.isUnsigned());
+    return true;
+  case requite::Opcode::_BITWISE_ROTATE_RIGHT:
+    lhs = llvm::APSInt(lhs.rotr(rhs), lhs.isUnsigned());
+    return true;
+  default:
+    break;
+  }
+  return false;
+}
+
+[[nodiscard]] static bool
+applyConstantRealOperation(llvm::APFloat &lhs, requite::Opcode opcode,
+                           const llvm::APFloat &rhs) {
+  if (&lhs.getSemantics() != &rhs.getSemantics()) {
+    return false;
+  }
+  constexpr llvm::RoundingMode rounding =
+      llvm::RoundingMode::NearestTiesToEven;
+  switch (opcode) {
+  case requite::Opcode::_ADD:
+    lhs.add(rhs, rounding);
+    return true;
+  case requite::Opcode::_SUBTRACT:
+    lhs.subtract(rhs, rounding);
+    return true;
+  case requite::Opcode::_MULTIPLY:
+    lhs.multiply(rhs, rounding);
+    return true;
+  case requite::Opcode::_DIVIDE:
+    lhs.divide(rhs, rounding);
+    return true;
+  case requite::Opcode::_MODULUS:
+    lhs.mod(rhs);
+    return true;
+  default:
+    break;
+  }
+  return false;
+}
+
+[[nodiscard]] static bool getIsComparisonTrue(requite::Opcode opcode,
+                                              llvm::APFloat::cmpResult result) {
+  switch (opcode) {
+  case requite::Opcode::_GREATER:
+    return result == llvm::APFloat::cmpGreaterThan;
+  case requite::Opcode::_GREATER_EQUAL:
+    return result == llvm::APFloat::cmpGreaterThan ||
+           result == llvm::APFloat::cmpEqual;
+  case requite::Opcode::_LESS:
+    return result == llvm::APFloat::cmpLessThan;
+  case requite::Opcode::_LESS_EQUAL:
+    return result == llvm::APFloat::cmpLessThan ||
+           result == llvm::APFloat::cmpEqual;
+  case requite::Opcode::_EQUAL:
+    return result == llvm::APFloat::cmpEqual;
+  case requite::Opcode::_NOT_EQUAL:
+    return result != llvm::APFloat::cmpEqual;
+  default:
+    break;
+  }
+  REQUITE_UNREACHABLE();
+}
+
+[[nodiscard]] static llvm::APFloat::cmpResult
+compareConstantIntegers(const llvm::APSInt &lhs, const llvm::APSInt &rhs) {
+  const int result = llvm::APSInt::compareValues(lhs, rhs);
+  if (result < 0) {
+    return llvm::APFloat::cmpLessThan;
+  } else if (result > 0) {
+    return llvm::APFloat::cmpGreaterThan;
+  }
+  return llvm::APFloat::cmpEqual;
+}
+
+template <typename ConstantParam, typename CompareParam>
+[[nodiscard]] static bool
+getIsConstantComparisonTrue(requite::Opcode opcode,
+                            llvm::ArrayRef<ConstantParam> operands,
+                            CompareParam compare) {
+  // Not equal holds only when every operand is distinct from every other.
+  // The remaining comparisons chain through each adjacent pair of operands.
+  if (opcode == requite::Opcode::_NOT_EQUAL) {
+    for (unsigned lhs_i = 0; lhs_i < operands.size(); ++lhs_i) {
+      for (unsigned rhs_i = lhs_i + 1; rhs_i < operands.size(); ++rhs_i) {
+        if (compare(operands[lhs_i], operands[rhs_i]) ==
+            llvm::APFloat::cmpEqual) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+  for (unsigned operand_i = 1; operand_i < operands.size(); ++operand_i) {
+    if (!requite::getIsComparisonTrue(
+            opcode, compare(operands[operand_i - 1], operands[operand_i]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Context::evaluateConstantUnsigned(unsigned &out_unsigned,
+                                       requite::Scope &scope,
+                                       requite::Expression &value_expression) {
+  switch (const requite::Opcode opcode = value_expression.getOpcode()) {
+  case requite::Opcode::__INTEGER_LITERAL: {
+    const llvm::APSInt &integer = value_expression.getInteger();
+    if (integer.isNegative() ||
+        integer.getActiveBits() > std::numeric_limits<unsigned>::digits) {
+      return false;
+    }
+    out_unsigned = static_cast<unsigned>(integer.getZExtValue());
+  }
+    return true;
+  case requite::Opcode::ADDRESS_DEPTH: {
+    out_unsigned = this->getAddressDepth();
+  }
+    return true;
+  case requite::Opcode::ADDRESS_SIZE: {
+    out_unsigned = this->getAddressSize();
+  }
+    return true;
+  default:
+    break;
+  }
+  return false;
+}
+
+bool Context::evaluateConstantInteger(llvm::APSInt &out_integer,
+                                      requite::Scope &scope,
+                                      requite::Expression &value_expression) {
+  switch (const requite::Opcode opcode = value_expression.getOpcode()) {
+  case requite::Opcode::__INTEGER_LITERAL:
+    return this->evaluateConstantIntegerLiteral(out_integer, value_expression);
+  case requite::Opcode::TRUE:
+    out_integer = requite::makeConstantBoolean(true);
+    return true;
+  case requite::Opcode::FALSE:
+    out_integer = requite::makeConstantBoolean(false);
+    return true;
+  case requite::Opcode::_ADD:
+    [[fallthrough]];
+  case requite::Opcode::_SUBTRACT:
+    [[fallthrough]];
+  case requite::Opcode::_MULTIPLY:
+    [[fallthrough]];
+  case requite::Opcode::_DIVIDE:
+    [[fallthrough]];
+  case requite::Opcode::_MODULUS:
+    [[fallthrough]];
+  case requite::Opcode::_BITWISE_OR:
+    [[fallthrough]];
+  case requite::Opcode::_BITWISE_AND:
+    [[fallthrough]];
+  case requite::Opcode::_BITWISE_XOR:
+    [[fallthrough]];
+  case requite::Opcode::_BITWISE_SHIFT_LEFT:
+    [[fallthrough]];
+  case requite::Opcode::_BITWISE_SHIFT_RIGHT:
+    [[fallthrough]];
+  case requite::Opcode::_BITWISE_ROTATE_LEFT:
+    [[fallthrough]];
+  case requite::Opcode::_BITWISE_ROTATE_RIGHT: {
+    requite::Expression &first = value_expression.getBranch();
+    if (!this->evaluateConstantInteger(out_integer, scope, first)) {
+      return false;
+    }
+    for (requite::Expression &operand : first.getNextSubrange()) {
+      llvm::APSInt rhs;
+      if (!this->evaluateConstantInteger(rhs, scope, operand) ||
+          !requite::applyConstantIntegerOperation(out_integer, opcode, rhs)) {
+        return false;
+      }
     }
+    return true;
+  }
+  case requite::Opcode::_NEGATE:
+    if (!this->evaluateConstantInteger(out_integer, scope,
+                                       value_expression.getBranch())) {
+      return false;
+    }
+    out_integer = -out_integer;
+    return true;
+  case requite::Opcode::_BITWISE_COMPLEMENT:
+    if (!this->evaluateConstantInteger(out_integer, scope,
+                                       value_expression.getBranch())) {
+      return false;
+    }
+    out_integer = ~out_integer;
+    return true;
+  case requite::Opcode::_LOGICAL_AND:
+    [[fallthrough]];
+  case requite::Opcode::_LOGICAL_OR: {
+    // Operands are evaluated in order and stop at the first operand that
+    // decides the result, matching the short circuit at runtime.
+    const bool is_and = opcode == requite::Opcode::_LOGICAL_AND;
+    for (requite::Expression &operand : value_expression.getBranchSubrange()) {
+      llvm::APSInt value;
+      if (!this->evaluateConstantInteger(value, scope, operand)) {
+        return false;
+      }
+      if (value.isZero() == is_and) {
+        out_integer = requite::makeConstantBoolean(!is_and);
+        return true;
+      }
+    }
+    out_integer = requite::makeConstantBoolean(is_and);
+    return true;
+  }
+  case requite::Opcode::_LOGICAL_COMPLEMENT: {
+    llvm::APSInt value;
+    if (!this->evaluateConstantInteger(value, scope,
+                                       value_expression.getBranch())) {
+      return false;
+    }
+    out_integer = requite::makeConstantBoolean(value.isZero());
+    return true;
+  }
+  case requite::Opcode::_GREATER:
+    [[fallthrough]];
+  case requite::Opcode::_GREATER_EQUAL:
+    [[fallthrough]];
+  case requite::Opcode::_LESS:
+    [[fallthrough]];
+  case requite::Opcode::_LESS_EQUAL:
+    [[fallthrough]];
+  case requite::Opcode::_EQUAL:
+    [[fallthrough]];
+  case requite::Opcode::_NOT_EQUAL:
+    return this->evaluateConstantComparison(out_integer, scope,
+                                            value_expression);
+  default:
+    break;
+  }
+  return false;
+}
+
+bool Context::evaluateConstantIntegerLiteral(
+    llvm::APSInt &out_integer, requite::Expression &literal_expression) {
+  REQUITE_ASSERT(literal_expression.getOpcode() ==
+                 requite::Opcode::__INTEGER_LITERAL);
+  // Literals carry the value decoded at parse time, which is widened to the
+  // literal's type here.
+  if (!literal_expression.getHasResolvedType()) {
+    return requite::getFittedInteger(literal_expression.getInteger(),
+                                     this->getAddressDepth(), false,
+                                     out_integer);
+  }
+  const requite::Symbol &type =
+      literal_expression.getResolvedType().getSymbol();
+  if (!type.getIsInteger()) {
     return false;
+  }
+  const unsigned depth = type.getRoot().getDepth();
+  const bool is_unsigned =
+      type.getRoot().getType() == requite::RootSymbolType::UNSIGNED_INTEGER;
+  return requite::getFittedInteger(literal_expression.getInteger(), depth,
+                                   is_unsigned, out_integer);
+}
+
+bool Context::evaluateConstantReal(llvm::APFloat &out_real,
+                                   requite::Scope &scope,
+                                   requite::Expression &value_expression) {
+  switch (const requite::Opcode opcode = value_expression.getOpcode()) {
+  case requite::Opcode::__REAL_LITERAL:
+    return requite::getNumericValue(value_expression.getSourceText(),
+                                    out_real,
+                                    requite::FloatSemantics::BINARY_DOUBLE) ==
+           requite::NumericResult::OK;
+  case requite::Opcode::_ADD:
+    [[fallthrough]];
+  case requite::Opcode::_SUBTRACT:
+    [[fallthrough]];
+  case requite::Opcode::_MULTIPLY:
+    [[fallthrough]];
+  case requite::Opcode::_DIVIDE:
+    [[fallthrough]];
+  case requite::Opcode::_MODULUS: {
+    requite::Expression &first = value_expression.getBranch();
+    if (!this->evaluateConstantReal(out_real, scope, first)) {
+      return false;
+    }
+    for (requite::Expression &operand : first.getNextSubrange()) {
+      llvm::APFloat rhs(out_real.getSemantics());
+      if (!this->evaluateConstantReal(rhs, scope, operand) ||
+          !requite::applyConstantRealOperation(out_real, opcode, rhs)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  case requite::Opcode::_NEGATE:
+    if (!this->evaluateConstantReal(out_real, scope,
+                                    value_expression.getBranch())) {
+      return false;
+    }
+    out_real.changeSign();
+    return true;
+  default:
+    break;
+  }
+  return false;
+}
+
+bool Context::evaluateConstantComparison(
+    llvm::APSInt &out_integer, requite::Scope &scope,
+    requite::Expression &comparison_expression) {
+  const requite::Opcode opcode = comparison_expression.getOpcode();
+  llvm::SmallVector<llvm::APSInt, 4> integers;
+  for (requite::Expression &operand :
+       comparison_expression.getBranchSubrange()) {
+    llvm::APSInt &integer = integers.emplace_back();
+    if (!this->evaluateConstantInteger(integer, scope, operand)) {
+      integers.clear();
+      break;
+    }
+    if (!requite::getIsSameIntegerType(integers.front(), integer)) {
+      return false;
+    }
+  }
+  if (!integers.empty()) {
+    out_integer = requite::makeConstantBoolean(
+        requite::getIsConstantComparisonTrue<llvm::APSInt>(
+            opcode, integers, requite::compareConstantIntegers));
+    return true;
+  }
+  llvm::SmallVector<llvm::APFloat, 4> reals;
+  for (requite::Expression &operand :
+       comparison_expression.getBranchSubrange()) {
+    llvm::APFloat &real = reals.emplace_back(llvm::APFloat::IEEEdouble());
+    if (!this->evaluateConstantReal(real, scope, operand)) {
+      return false;
+    }
+  }
+  out_integer = requite::makeConstantBoolean(
+      requite::getIsConstantComparisonTrue<llvm::APFloat>(
+          opcode, reals,
+          [](const llvm::APFloat &lhs, const llvm::APFloat &rhs) {
+            return lhs.compare(rhs);
+          }));
+  return true;
+}
+
+void Context::foldConstantValue(requite::Scope &scope,
+                                requite::Expression &value_expression) {
+  // Only values whose type has already been inferred are folded, so the
+  // folded literal keeps the width and signedness the builder expects.
+  if (!value_expression.getHasResolvedType() ||
+      value_expression.getOpcode() == requite::Opcode::__INTEGER_LITERAL) {
+    return;
+  }
+  const requite::Symbol &type = value_expression.getResolvedType().getSymbol();
+  if (!type.getIsInteger()) {
+    return;
+  }
+  // Operands are folded first, so a value that is not constant as a whole
+  // still has its constant operands folded, and a constant value is
+  // evaluated from literals instead of walking its whole subtree again.
+  for (requite::Expression &operand : value_expression.getBranchSubrange()) {
+    this->foldConstantValue(scope, operand);
+  }
+  llvm::APSInt value;
+  if (!this->evaluateConstantInteger(value, scope, value_expression)) {
+    return;
+  }
+  if (value.getBitWidth() != type.getRoot().getDepth()) {
+    return;
+  }
+  requite::Expression::deleteExpression(value_expression.popBranch());
+  value_expression.changeOpcode(requite::Opcode::__INTEGER_LITERAL);
+  value_expression.emplaceInteger() = std::move(value);
 }
 
-}
\ No newline at end of file
+} // namespace requite
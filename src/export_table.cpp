@@ -10,11 +10,11 @@ bool ExportTable::operator!=(const Self& rhs) const {
     return this == &rhs;
 }
 
-llvm::StringMap<requite::RootSymbol> &ExportTable::getSymbolMap() {
+requite::SymbolMap &ExportTable::getSymbolMap() {
     return this->_exported_symbol_map;
 }
 
-const llvm::StringMap<requite::RootSymbol> &ExportTable::getSymbolMap() const {
+const requite::SymbolMap &ExportTable::getSymbolMap() const {
     return this->_exported_symbol_map;
 }
 
@@ -14,19 +14,21 @@ void Expression::deleteExpression(requite::Expression &expression)
     if (expression.getHasNext()) {
         requite::Expression::deleteExpression(expression.getNext());
     }
-    delete &expression;
+    if (!expression._is_in_array) {
+        delete &expression;
+    }
 }
 
 requite::Expression& Expression::copyExpression(const requite::Expression& expression)
 {
     requite::Expression& new_expression = requite::getRef(new requite::Expression());
+    new_expression._opcode = expression._opcode;
     if (expression.getHasBranch()) {
         new_expression.setBranch(requite::Expression::copyExpression(expression.getBranch()));
     }
     if (expression.getHasNext()) {
         new_expression.setNext(requite::Expression::copyExpression(expression.getNext()));
     }
-    new_expression._opcode = expression._opcode;
     new_expression._source_text_ptr = expression._source_text_ptr;
     new_expression._source_text_length = expression._source_text_length;
     new_expression._data = expression._data;
@@ -65,7 +67,7 @@ requite::Expression &Expression::makeString(llvm::StringRef text)
 {
     requite::Expression &expression = requite::getRef(new requite::Expression());
     expression._opcode = requite::Opcode::__STRING_LITERAL;
-    expression._data.emplace<std::string>(text.str());
+    expression._data.emplace<llvm::StringRef>(text);
     return expression;
 }
 
@@ -73,7 +75,7 @@ requite::Expression &Expression::makeCodeunit(llvm::StringRef text)
 {
     requite::Expression &expression = requite::getRef(new requite::Expression());
     expression._opcode = requite::Opcode::__CODEUNIT_LITERAL;
-    expression._data.emplace<std::string>(text.str());
+    expression._data.emplace<llvm::StringRef>(text);
     return expression;
 }
 
@@ -38,8 +38,8 @@ bool Context::loadFileBuffer(requite::File &file, llvm::StringRef path) {
   std::error_code ec = llvm::sys::fs::make_absolute(path_buffer);
   if (ec) {
     this->logMessage(
-        llvm::Twine(
-            "error: failed to determine source file path\n\tfile: ") +
+        requite::LogType::ERROR, "source-file-path-failed",
+        llvm::Twine("failed to determine source file path\n\tfile: ") +
         llvm::Twine(file.getPath()) + llvm::Twine("\n\treason: ") +
         llvm::Twine(ec.message()));
     return false;
@@ -52,8 +52,8 @@ bool Context::loadFileBuffer(requite::File &file, llvm::StringRef path) {
                                   std::nullopt);
   if (!buffer_eo) {
     this->logMessage(
-        llvm::Twine(
-            "error: failed to create read buffer for file\n\tfile: ") +
+        requite::LogType::ERROR, "read-source-file-failed",
+        llvm::Twine("failed to create read buffer for file\n\tfile: ") +
         llvm::Twine(file.getPath()) + llvm::Twine("\n\treason: ") +
         llvm::Twine(buffer_eo.getError().message()));
     return false;
@@ -0,0 +1,433 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include <requite/alias.hpp>
+#include <requite/anonymous_object.hpp>
+#include <requite/assert.hpp>
+#include <requite/attribute_flags.hpp>
+#include <requite/attribute_type.hpp>
+#include <requite/context.hpp>
+#include <requite/export_table.hpp>
+#include <requite/fingerprint.hpp>
+#include <requite/label.hpp>
+#include <requite/module.hpp>
+#include <requite/named_procedure_group.hpp>
+#include <requite/object.hpp>
+#include <requite/options.hpp>
+#include <requite/ordered_variable.hpp>
+#include <requite/procedure.hpp>
+#include <requite/procedure_type.hpp>
+#include <requite/signature.hpp>
+#include <requite/signature_parameter.hpp>
+#include <requite/strings.hpp>
+#include <requite/symbol.hpp>
+#include <requite/table.hpp>
+#include <requite/tuple.hpp>
+#include <requite/unordered_variable.hpp>
+#include <requite/variable_type.hpp>
+
+#include <llvm/ADT/STLExtras.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/ADT/Twine.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/xxhash.h>
+#include <llvm/TargetParser/Host.h>
+
+#include <magic_enum.hpp>
+
+namespace requite {
+
+[[nodiscard]] static std::uint64_t getHash(llvm::StringRef text) {
+  return llvm::xxh3_64bits(llvm::arrayRefFromStringRef(text));
+}
+
+[[nodiscard]] static bool readHash(std::uint64_t &out_hash,
+                                   llvm::StringRef text) {
+  return !text.getAsInteger(16, out_hash);
+}
+
+std::uint64_t Fingerprint::getSourceHash() const { return this->_source_hash; }
+
+void Fingerprint::setSourceHash(llvm::StringRef source_text) {
+  this->_source_hash = requite::getHash(source_text);
+}
+
+std::uint64_t Fingerprint::getFlagsHash() const { return this->_flags_hash; }
+
+void Fingerprint::setFlagsHash(llvm::StringRef target_triple) {
+  llvm::SmallString<128> buffer;
+  llvm::raw_svector_ostream ostream(buffer);
+  // Options are hashed by name so that reordering their enumerations does not
+  // make a previous build look like it used the same options.
+  ostream << requite::FINGERPRINT_VERSION << '\n'
+          << magic_enum::enum_name(requite::getEmitMode()) << '\n'
+          << magic_enum::enum_name(requite::getForm()) << '\n'
+          << target_triple << '\n';
+  this->_flags_hash = requite::getHash(buffer);
+}
+
+static void writeInterface(llvm::raw_ostream &ostream,
+                           const requite::Symbol &symbol);
+
+static void writeInterface(llvm::raw_ostream &ostream,
+                           const requite::AttributeFlags &attributes) {
+  for (unsigned type_i = 0; type_i < requite::ATTRIBUTE_TYPE_COUNT; ++type_i) {
+    const requite::AttributeType type =
+        static_cast<requite::AttributeType>(type_i);
+    if (attributes.getHasAttribute(type)) {
+      ostream << requite::getName(type) << ' ';
+    }
+  }
+}
+
+static void writeInterface(llvm::raw_ostream &ostream,
+                           const requite::Signature &signature) {
+  ostream << '(';
+  for (const requite::SignatureParameter &parameter :
+       signature.getParameters()) {
+    ostream << parameter.getName() << ": ";
+    requite::writeInterface(ostream, parameter.getType());
+    ostream << ", ";
+  }
+  ostream << ") -> ";
+  requite::writeInterface(ostream, signature.getReturnType());
+}
+
+static void writeInterface(llvm::raw_ostream &ostream,
+                           const requite::Procedure &procedure) {
+  ostream << requite::getName(procedure.getType()) << ' ';
+  requite::writeInterface(ostream, procedure.getAttributeFlags());
+  requite::writeInterface(ostream, procedure.getSignature());
+  ostream << '\n';
+}
+
+// Writes a root symbol as a type refers to it. User symbols are referred to by
+// name, and their definitions are only written for the exports themselves.
+static void writeInterface(llvm::raw_ostream &ostream,
+                           const requite::RootSymbol &root) {
+  const requite::RootSymbolType type = root.getType();
+  ostream << magic_enum::enum_name(type);
+  if (requite::getHasDepth(type)) {
+    ostream << ' ' << root.getDepth();
+  }
+  switch (type) {
+  case requite::RootSymbolType::SIGNATURE:
+    ostream << ' ';
+    requite::writeInterface(ostream, root.getSignature());
+    break;
+  case requite::RootSymbolType::TUPLE:
+    ostream << " (";
+    for (const requite::Symbol &element : root.getTuple().getElementTypes()) {
+      requite::writeInterface(ostream, element);
+      ostream << ", ";
+    }
+    ostream << ')';
+    break;
+  case requite::RootSymbolType::ANONYMOUS_OBJECT:
+    ostream << " (";
+    for (const requite::AnonymousProperty &property :
+         root.getAnonymousObject().getProperties()) {
+      ostream << property.getName() << ": ";
+      requite::writeInterface(ostream, property.getSymbol());
+      ostream << ", ";
+    }
+    ostream << ')';
+    break;
+  case requite::RootSymbolType::OBJECT:
+    ostream << ' ' << root.getObject().getName();
+    break;
+  case requite::RootSymbolType::TABLE:
+    ostream << ' ' << root.getTable().getName();
+    break;
+  case requite::RootSymbolType::ALIAS:
+    ostream << ' ' << root.getAlias().getName();
+    break;
+  case requite::RootSymbolType::ORDERED_VARIABLE:
+    ostream << ' ' << root.getOrderedVariable().getName();
+    break;
+  case requite::RootSymbolType::UNORDERED_VARIABLE:
+    ostream << ' ' << root.getUnorderedVariable().getName();
+    break;
+  case requite::RootSymbolType::NAMED_PROCEDURE_GROUP:
+    ostream << ' '
+            << requite::getRef(root._named_procedure_group_ptr).getName();
+    break;
+  case requite::RootSymbolType::MODULE:
+    ostream << ' ' << root.getModule().getName();
+    break;
+  case requite::RootSymbolType::LABEL:
+    ostream << ' ' << root.getLabel().getName();
+    break;
+  default:
+    break;
+  }
+}
+
+static void writeInterface(llvm::raw_ostream &ostream,
+                           const requite::Symbol &symbol) {
+  for (const requite::SubSymbol &sub : symbol.getSubs()) {
+    requite::writeInterface(ostream, sub.getAttributeFlags());
+    ostream << magic_enum::enum_name(sub.getType());
+    if (sub.getHasInferencedCount()) {
+      ostream << " inferenced";
+    } else if (sub.getCount() != 0) {
+      ostream << ' ' << sub.getCount();
+    }
+    ostream << " of ";
+  }
+  requite::writeInterface(ostream, symbol.getRootAttributeFlags());
+  requite::writeInterface(ostream, symbol.getRoot());
+}
+
+// Writes everything about an exported symbol that importing modules can
+// depend on.
+static void writeExportInterface(llvm::raw_ostream &ostream,
+                                 const requite::RootSymbol &root) {
+  requite::writeInterface(ostream, root);
+  ostream << '\n';
+  switch (root.getType()) {
+  case requite::RootSymbolType::OBJECT: {
+    const requite::Object &object = root.getObject();
+    requite::writeInterface(ostream, object.getAttributeFlags());
+    ostream << '\n';
+    for (const requite::UnorderedVariable *property_ptr :
+         object._property_ptrs) {
+      const requite::UnorderedVariable &property =
+          requite::getRef(property_ptr);
+      ostream << property.getName() << ": ";
+      requite::writeInterface(ostream, property.getDataType());
+      ostream << '\n';
+    }
+    if (object.getHasConstructor()) {
+      const requite::Procedure *constructor_ptr = &object.getFirstConstructor();
+      while (true) {
+        requite::writeInterface(ostream, *constructor_ptr);
+        if (!constructor_ptr->getHasNextProcedure()) {
+          break;
+        }
+        constructor_ptr = &constructor_ptr->getNextProcedure();
+      }
+    }
+    if (object.getHasDestructor()) {
+      requite::writeInterface(ostream, object.getDestructor());
+    }
+  } break;
+  case requite::RootSymbolType::ALIAS: {
+    const requite::Alias &alias = root.getAlias();
+    requite::writeInterface(ostream, alias.getAttributeFlags());
+    requite::writeInterface(ostream, alias.getSymbol());
+    ostream << '\n';
+  } break;
+  case requite::RootSymbolType::ORDERED_VARIABLE: {
+    const requite::OrderedVariable &variable = root.getOrderedVariable();
+    ostream << requite::getName(variable.getType()) << ' ';
+    requite::writeInterface(ostream, variable.getDataType());
+    ostream << '\n';
+  } break;
+  case requite::RootSymbolType::UNORDERED_VARIABLE: {
+    const requite::UnorderedVariable &variable = root.getUnorderedVariable();
+    ostream << requite::getName(variable.getType()) << ' ';
+    requite::writeInterface(ostream, variable.getAttributeFlags());
+    requite::writeInterface(ostream, variable.getDataType());
+    ostream << '\n';
+  } break;
+  case requite::RootSymbolType::PROCEDURE:
+    requite::writeInterface(ostream, root.getProcedure());
+    break;
+  case requite::RootSymbolType::NAMED_PROCEDURE_GROUP: {
+    const requite::NamedProcedureGroup &group =
+        requite::getRef(root._named_procedure_group_ptr);
+    if (!group.getHasProcedures()) {
+      break;
+    }
+    const requite::Procedure *procedure_ptr = &group.getFirstProcedure();
+    while (true) {
+      requite::writeInterface(ostream, *procedure_ptr);
+      if (!procedure_ptr->getHasNextProcedure()) {
+        break;
+      }
+      procedure_ptr = &procedure_ptr->getNextProcedure();
+    }
+  } break;
+  default:
+    break;
+  }
+}
+
+std::uint64_t Fingerprint::getExportHash() const { return this->_export_hash; }
+
+void Fingerprint::setExportHash(const requite::ExportTable &table) {
+  // Symbol map iteration follows insertion order, so the entries are sorted
+  // by name to keep the hash independent of declaration order.
+  llvm::SmallVector<const requite::SymbolMapEntry *, 32> entries;
+  for (const requite::SymbolMapEntry &entry : table.getSymbolMap()) {
+    entries.push_back(&entry);
+  }
+  llvm::sort(entries, [](const requite::SymbolMapEntry *lhs,
+                         const requite::SymbolMapEntry *rhs) {
+    return lhs->getName() < rhs->getName();
+  });
+  llvm::SmallString<256> buffer;
+  llvm::raw_svector_ostream ostream(buffer);
+  for (const requite::SymbolMapEntry *entry : entries) {
+    ostream << entry->getName() << '\0';
+    requite::writeExportInterface(ostream, entry->getSymbol());
+  }
+  this->_export_hash = requite::getHash(buffer);
+}
+
+llvm::StringMap<std::uint64_t> &Fingerprint::getImportExportHashes() {
+  return this->_import_export_hashes;
+}
+
+const llvm::StringMap<std::uint64_t> &
+Fingerprint::getImportExportHashes() const {
+  return this->_import_export_hashes;
+}
+
+void Fingerprint::addImport(llvm::StringRef fingerprint_path,
+                            std::uint64_t export_hash) {
+  this->getImportExportHashes()[fingerprint_path] = export_hash;
+}
+
+bool Fingerprint::getIsInputSame(const Self &rhs) const {
+  return this->getSourceHash() == rhs.getSourceHash() &&
+         this->getFlagsHash() == rhs.getFlagsHash();
+}
+
+void Fingerprint::write(llvm::raw_ostream &ostream) const {
+  ostream << "source " << llvm::format_hex_no_prefix(this->getSourceHash(), 16)
+          << '\n';
+  ostream << "flags " << llvm::format_hex_no_prefix(this->getFlagsHash(), 16)
+          << '\n';
+  ostream << "exports "
+          << llvm::format_hex_no_prefix(this->getExportHash(), 16) << '\n';
+  for (const auto &entry : this->getImportExportHashes()) {
+    ostream << "import " << llvm::format_hex_no_prefix(entry.getValue(), 16)
+            << ' ' << entry.getKey() << '\n';
+  }
+}
+
+bool Fingerprint::read(llvm::StringRef text) {
+  llvm::SmallVector<llvm::StringRef, 8> lines;
+  text.split(lines, '\n', -1, false);
+  bool has_source = false;
+  bool has_flags = false;
+  bool has_exports = false;
+  for (llvm::StringRef line : lines) {
+    auto [key, rest] = line.split(' ');
+    if (key == "source") {
+      has_source = requite::readHash(this->_source_hash, rest);
+    } else if (key == "flags") {
+      has_flags = requite::readHash(this->_flags_hash, rest);
+    } else if (key == "exports") {
+      has_exports = requite::readHash(this->_export_hash, rest);
+    } else if (key == "import") {
+      auto [hash_text, path] = rest.split(' ');
+      std::uint64_t hash = 0;
+      if (path.empty() || !requite::readHash(hash, hash_text)) {
+        return false;
+      }
+      this->addImport(path, hash);
+    } else {
+      return false;
+    }
+  }
+  return has_source && has_flags && has_exports;
+}
+
+void getFingerprintPath(llvm::SmallVectorImpl<char> &out_path,
+                        llvm::StringRef output_path) {
+  out_path.clear();
+  llvm::raw_svector_ostream ostream(out_path);
+  ostream << output_path << requite::FINGERPRINT_FILE_EXTENSION;
+}
+
+bool Context::readFingerprint(requite::Fingerprint &out_fingerprint,
+                              llvm::StringRef fingerprint_path) {
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer_eo =
+      llvm::MemoryBuffer::getFile(fingerprint_path, true, false);
+  if (!buffer_eo) {
+    return false;
+  }
+  return out_fingerprint.read(buffer_eo.get()->getBuffer());
+}
+
+void Context::fingerprintModuleInput(requite::Module &module) {
+  requite::Fingerprint &fingerprint = module.getFingerprint();
+  fingerprint.setSourceHash(module.getText());
+  fingerprint.setFlagsHash(llvm::sys::getDefaultTargetTriple());
+}
+
+bool Context::getIsModuleUpToDate(requite::Module &module,
+                                  llvm::StringRef output_path) {
+  if (!llvm::sys::fs::exists(output_path)) {
+    return false;
+  }
+  llvm::SmallString<256> fingerprint_path;
+  requite::getFingerprintPath(fingerprint_path, output_path);
+  requite::Fingerprint previous = {};
+  if (!this->readFingerprint(previous, fingerprint_path)) {
+    return false;
+  }
+  if (!module.getFingerprint().getIsInputSame(previous)) {
+    return false;
+  }
+  // The module's own source is unchanged, so it only needs rebuilding if an
+  // imported module's exported interface changed since the last build.
+  for (const auto &entry : previous.getImportExportHashes()) {
+    requite::Fingerprint imported = {};
+    if (!this->readFingerprint(imported, entry.getKey())) {
+      return false;
+    }
+    if (imported.getExportHash() != entry.getValue()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Context::removeModuleFingerprint(llvm::StringRef output_path) {
+  // A stale fingerprint must not outlive a rebuild that fails part way through
+  // writing the output, or the partial output would be reused next time.
+  llvm::SmallString<256> fingerprint_path;
+  requite::getFingerprintPath(fingerprint_path, output_path);
+  llvm::sys::fs::remove(fingerprint_path);
+}
+
+bool Context::writeModuleFingerprint(requite::Module &module,
+                                     llvm::StringRef output_path) {
+  if (!requite::getIsIncremental()) {
+    // A fingerprint left by an earlier incremental build no longer describes
+    // the output that was just written over.
+    this->removeModuleFingerprint(output_path);
+    return true;
+  }
+  requite::Fingerprint &fingerprint = module.getFingerprint();
+  const requite::Scope &scope = module.getScope();
+  if (scope.getHasExportTable()) {
+    fingerprint.setExportHash(scope.getExportTable());
+  }
+  llvm::SmallString<256> fingerprint_path;
+  requite::getFingerprintPath(fingerprint_path, output_path);
+  std::error_code ec;
+  llvm::raw_fd_ostream fout(fingerprint_path, ec, llvm::sys::fs::OF_Text);
+  if (ec) {
+    this->logMessage(
+        requite::LogType::ERROR, "open-fingerprint-file-failed",
+        llvm::Twine("failed to open fingerprint file for writing\n\tpath: ") +
+        llvm::Twine(fingerprint_path) + llvm::Twine("\n\treason: ") +
+        llvm::Twine(ec.message()));
+    return false;
+  }
+  fingerprint.write(fout);
+  fout.flush();
+  return true;
+}
+
+} // namespace requite
@@ -58,7 +58,8 @@ bool Context::initializeLlvmTarget() {
       llvm::TargetRegistry::lookupTarget(this->_target_triple, error);
   if (this->_llvm_target_ptr == nullptr) {
     this->logMessage(
-        llvm::Twine("error: failed to find llvm target.\n\ttriple: ") +
+        requite::LogType::ERROR, "llvm-target-not-found",
+        llvm::Twine("failed to find llvm target.\n\ttriple: ") +
         llvm::Twine(this->_target_triple.c_str()) + llvm::Twine("\n\terror: ") +
         llvm::Twine(error.c_str()));
     is_ok = false;
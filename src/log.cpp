@@ -11,102 +11,151 @@
 #include <requite/options.hpp>
 #include <requite/token.hpp>
 #include <requite/symbol.hpp>
+#include <requite/unreachable.hpp>
 
 #include <llvm/Support/raw_ostream.h>
 
-#include <mutex>
+#include <utility>
 
 namespace requite {
 
-void Context::logMessage(llvm::Twine message) {
-  std::scoped_lock guard(this->_mutex);
-  llvm::outs() << message << "\n";
+requite::Diagnostics &Context::getDiagnostics() { return this->_diagnostics; }
+
+const requite::Diagnostics &Context::getDiagnostics() const {
+  return this->_diagnostics;
+}
+
+bool Context::getIsErrorLimitReached() const {
+  return this->getDiagnostics().getIsErrorLimitReached();
+}
+
+void Context::renderDiagnostics() {
+  requite::Diagnostics &diagnostics = this->getDiagnostics();
+  switch (requite::getDiagnosticsFormat()) {
+  case requite::DIAGNOSTICS_FORMAT_TEXT:
+    diagnostics.render(this->_source_mgr, llvm::outs());
+    return;
+  case requite::DIAGNOSTICS_FORMAT_JSON:
+    diagnostics.writeJson(this->_source_mgr, llvm::outs(),
+                          requite::getIsDiagnosticsLineColumnShown());
+    return;
+  case requite::DIAGNOSTICS_FORMAT_SARIF:
+    diagnostics.writeSarif(this->_source_mgr, llvm::outs(),
+                           requite::getIsDiagnosticsLineColumnShown());
+    return;
+  }
+  REQUITE_UNREACHABLE();
+}
+
+void Context::logMessage(requite::LogType type, llvm::StringRef id,
+                         llvm::Twine message) {
+  requite::Diagnostic diagnostic;
+  diagnostic._type = type;
+  diagnostic._message = message.str();
+  diagnostic._id = id;
+  this->getDiagnostics().report(std::move(diagnostic));
 }
 
-void Context::logInputFileMessage(requite::LogType type, llvm::Twine message) {
+void Context::logInputFileMessage(requite::LogType type, llvm::StringRef id,
+                                  llvm::Twine message) {
   llvm::StringRef input_path = requite::getInputFilePath();
-  this->logSourceMessage(input_path, type, message);
+  this->logIdentifiedSourceMessage(input_path, type, id, message);
 }
 
-void Context::logSourceMessage(llvm::Twine filename, requite::LogType type,
-                               llvm::Twine message) {
-  llvm::SmallString<128> buffer_a;
-  llvm::SmallString<128> buffer_b;
-  std::scoped_lock guard(this->_mutex);
-  this->_source_mgr.PrintMessage(
-      llvm::outs(),
-      llvm::SMDiagnostic(filename.toStringRef(buffer_a),
-                         static_cast<llvm::SourceMgr::DiagKind>(type),
-                         message.toStringRef(buffer_b)));
+void Context::logIdentifiedSourceMessage(llvm::Twine filename,
+                                         requite::LogType type,
+                                         llvm::StringRef id,
+                                         llvm::Twine message) {
+  requite::Diagnostic diagnostic;
+  diagnostic._type = type;
+  diagnostic._filename = filename.str();
+  diagnostic._message = message.str();
+  diagnostic._id = id;
+  this->getDiagnostics().report(std::move(diagnostic));
 }
 
-void Context::logSourceMessage(const requite::Token &token,
-                               requite::LogType type, llvm::Twine message,
-                               llvm::ArrayRef<llvm::SMRange> ranges,
-                               llvm::ArrayRef<llvm::SMFixIt> fixits) {
-  std::scoped_lock guard(this->_mutex);
-  this->_source_mgr.PrintMessage(
-      llvm::outs(), llvm::SMLoc::getFromPointer(token.getSourceTextPtr()),
-      static_cast<llvm::SourceMgr::DiagKind>(type), message, ranges, fixits,
-      true);
+void Context::logIdentifiedSourceMessage(
+    const requite::Token &token, requite::LogType type, llvm::StringRef id,
+    llvm::Twine message, llvm::ArrayRef<llvm::SMRange> ranges,
+    llvm::ArrayRef<llvm::SMFixIt> fixits) {
+  requite::Diagnostic diagnostic;
+  diagnostic._type = type;
+  diagnostic._location = llvm::SMLoc::getFromPointer(token.getSourceTextPtr());
+  diagnostic._message = message.str();
+  diagnostic._id = id;
+  diagnostic._ranges.append(ranges.begin(), ranges.end());
+  diagnostic._fixits.append(fixits.begin(), fixits.end());
+  this->getDiagnostics().report(std::move(diagnostic));
 }
 
-void Context::logSourceMessage(const requite::Expression &expression,
-                               requite::LogType type, llvm::Twine message,
-                               llvm::ArrayRef<llvm::SMRange> ranges,
-                               llvm::ArrayRef<llvm::SMFixIt> fixits) {
-  std::scoped_lock guard(this->_mutex);
-  this->_source_mgr.PrintMessage(
-      llvm::outs(), llvm::SMLoc::getFromPointer(expression.getSourceTextPtr()),
-      static_cast<llvm::SourceMgr::DiagKind>(type), message, ranges, fixits,
-      true);
+void Context::logIdentifiedSourceMessage(
+    const requite::Expression &expression, requite::LogType type,
+    llvm::StringRef id, llvm::Twine message,
+    llvm::ArrayRef<llvm::SMRange> ranges,
+    llvm::ArrayRef<llvm::SMFixIt> fixits) {
+  requite::Diagnostic diagnostic;
+  diagnostic._type = type;
+  diagnostic._location =
+      llvm::SMLoc::getFromPointer(expression.getSourceTextPtr());
+  diagnostic._message = message.str();
+  diagnostic._id = id;
+  diagnostic._opcode = expression.getOpcode();
+  diagnostic._ranges.append(ranges.begin(), ranges.end());
+  diagnostic._fixits.append(fixits.begin(), fixits.end());
+  this->getDiagnostics().report(std::move(diagnostic));
 }
 
 void Context::logErrorNonInstantEvaluatableName(
     requite::Expression &expression) {
-  this->logSourceMessage(expression, requite::LogType::ERROR,
-                         "symbol names must be instantly evaluatable");
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "non-instant-evaluatable-name",
+      "symbol names must be instantly evaluatable");
 }
 
 void Context::logErrorNonExternallyAccessableTable(
     requite::Expression &expression) {
-  this->logSourceMessage(
-      expression, requite::LogType::ERROR,
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "non-externally-accessable-table",
       "symbol does not have externally accessable lookup table");
 }
 
 void Context::logErrorAlreadySymbolOfName(requite::Expression &expression) {
-  this->logSourceMessage(expression, requite::LogType::ERROR,
-                         "already symbol of name");
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "already-symbol-of-name",
+      "already symbol of name");
 }
 
 void Context::logErrorDuplicateAttribute(requite::Expression &expression,
                                          requite::AttributeType type) {
-  this->logSourceMessage(expression, requite::LogType::ERROR,
-                         llvm::Twine(requite::getName(type)) +
-                             " attribute is ascribed more than once");
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "duplicate-attribute",
+      llvm::Twine(requite::getName(type)) +
+          " attribute is ascribed more than once");
 }
 
 void Context::logErrorMustNotHaveAttributeFlags(
     requite::Expression &expression) {
-  this->logSourceMessage(expression, requite::LogType::ERROR,
-                         llvm::Twine(requite::getName(expression.getOpcode())) +
-                             " must not have attributes");
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "must-not-have-attributes",
+      llvm::Twine(requite::getName(expression.getOpcode())) +
+          " must not have attributes");
 }
 
 void Context::logNotSupportedYet(requite::Expression &expression) {
-  this->logSourceMessage(expression, requite::LogType::ERROR,
-                         "not supported yet");
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "not-supported-yet",
+      "not supported yet");
 }
 
 void Context::logErrorInvalidExpectedTypeForOperation(
     requite::Expression &expression, const requite::Symbol &expected_type) {
   llvm::SmallString<32> buffer;
   llvm::StringRef type_name = expected_type.getName(buffer);
-  this->logSourceMessage(expression, requite::LogType::ERROR,
-                         llvm::Twine("operation of opcode \"") +
-                             requite::getName(expression.getOpcode()) +
-                             "\" can not result in value of type" + type_name);
+  this->logIdentifiedSourceMessage(
+      expression, requite::LogType::ERROR, "invalid-expected-type",
+      llvm::Twine("operation of opcode \"") +
+          requite::getName(expression.getOpcode()) +
+          "\" can not result in value of type" + type_name);
 }
 
 } // namespace requite
\ No newline at end of file
@@ -6,30 +6,50 @@
 #include <requite/export_table.hpp>
 #include <requite/scope.hpp>
 #include <requite/symbol.hpp>
+#include <requite/symbol_map.hpp>
 
+#include <atomic>
 #include <string_view>
 
 namespace requite {
 
+// Advanced whenever a binding is added to any scope. A cache filled at the
+// current generation is valid without walking the containing scopes, at the
+// cost of also being refilled after additions to scopes it can not see.
+static std::atomic<std::uint64_t> SYMBOL_GENERATION = 1;
+
 requite::RootSymbol Scope::lookupInternalUserSymbol(llvm::StringRef name) {
-  REQUITE_ASSERT(!name.empty());
-  llvm::StringMapIterator<requite::RootSymbol> it =
-      this->getInternalSymbolMap().find(name);
-  if (it != this->getInternalSymbolMap().end()) {
-    return requite::RootSymbol(it->second);
+  return this->lookupInternalUserSymbol(requite::HashedName(name));
+}
+
+requite::RootSymbol
+Scope::lookupInternalUserSymbol(const requite::HashedName &name) {
+  REQUITE_ASSERT(!name.getText().empty());
+  const requite::RootSymbol *root_ptr = this->getInternalSymbolMap().find(name);
+  if (root_ptr != nullptr) {
+    return requite::RootSymbol(*root_ptr);
   }
   return requite::RootSymbol();
 }
 
 requite::RootSymbol Scope::lookupExportUserSymbol(llvm::StringRef name) {
-  REQUITE_ASSERT(!name.empty());
+  return this->lookupExportUserSymbol(requite::HashedName(name));
+}
+
+requite::RootSymbol
+Scope::lookupExportUserSymbol(const requite::HashedName &name) {
+  REQUITE_ASSERT(!name.getText().empty());
   requite::ExportTable &export_table = this->getExportTable();
   requite::RootSymbol root = export_table.lookupExportUserSymbol(name);
   return root;
 }
 
 requite::RootSymbol Scope::lookupUserSymbol(llvm::StringRef name) {
-  REQUITE_ASSERT(!name.empty());
+  return this->lookupUserSymbol(requite::HashedName(name));
+}
+
+requite::RootSymbol Scope::lookupUserSymbol(const requite::HashedName &name) {
+  REQUITE_ASSERT(!name.getText().empty());
   requite::RootSymbol root = this->lookupInternalUserSymbol(name);
   if (root.getIsNone()) {
     if (this->getHasExportTable()) {
@@ -39,14 +59,59 @@ requite::RootSymbol Scope::lookupUserSymbol(llvm::StringRef name) {
   return root;
 }
 
+requite::RootSymbol
+Scope::lookupVisibleTypeSymbol(const requite::HashedName &name) {
+  REQUITE_ASSERT(!name.getText().empty());
+  const std::uint64_t generation = requite::Scope::getSymbolGeneration();
+  if (this->_visible_symbol_cache_generation != generation) {
+    this->_visible_symbol_cache.clear();
+    this->_visible_symbol_cache_generation = generation;
+  }
+  const requite::RootSymbol *cached_ptr =
+      this->_visible_symbol_cache.find(name);
+  if (cached_ptr != nullptr) {
+    return requite::RootSymbol(*cached_ptr);
+  }
+  // The nearest alias or object is found by walking up the containing scopes.
+  // Other bindings of the name do not name a type and are skipped. Only this
+  // scope's cache is filled, so procedures looking up names in parallel never
+  // write to the scopes they share.
+  requite::RootSymbol root = {};
+  for (requite::Scope &scope : this->getContainingSubrange()) {
+    root = scope.lookupInternalUserSymbol(name);
+    if (root.getIsAlias() || root.getIsObject()) {
+      break;
+    }
+    root = requite::RootSymbol();
+  }
+  // Misses are cached as well so that repeated references to names from
+  // outside the scope chain stay cheap.
+  const bool is_inserted =
+      this->_visible_symbol_cache.insert(name, requite::RootSymbol(root));
+  REQUITE_ASSERT(is_inserted);
+  return root;
+}
+
+std::uint64_t Scope::getSymbolGeneration() {
+  return requite::SYMBOL_GENERATION.load(std::memory_order_acquire);
+}
+
+void Scope::advanceSymbolGeneration() {
+  requite::SYMBOL_GENERATION.fetch_add(1, std::memory_order_acq_rel);
+}
+
 requite::RootSymbol ExportTable::lookupExportUserSymbol(llvm::StringRef name) {
-  REQUITE_ASSERT(!name.empty());
-  llvm::StringMapIterator<requite::RootSymbol> it =
-      this->getSymbolMap().find(name);
-  if (it != this->getSymbolMap().end()) {
-    return requite::RootSymbol(it->second);
+  return this->lookupExportUserSymbol(requite::HashedName(name));
+}
+
+requite::RootSymbol
+ExportTable::lookupExportUserSymbol(const requite::HashedName &name) {
+  REQUITE_ASSERT(!name.getText().empty());
+  const requite::RootSymbol *root_ptr = this->getSymbolMap().find(name);
+  if (root_ptr != nullptr) {
+    return requite::RootSymbol(*root_ptr);
   }
   return requite::RootSymbol();
 }
 
-} // namespace requite
\ No newline at end of file
+} // namespace requite
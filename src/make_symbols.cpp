@@ -2,8 +2,11 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <requite/alias.hpp>
+#include <requite/anonymous_function.hpp>
 #include <requite/assert.hpp>
 #include <requite/context.hpp>
+#include <requite/label.hpp>
 #include <requite/named_procedure_group.hpp>
 #include <requite/node.hpp>
 #include <requite/object.hpp>
@@ -12,163 +15,67 @@
 #include <requite/table.hpp>
 #include <requite/ordered_variable.hpp>
 #include <requite/unordered_variable.hpp>
+#include <requite/utility.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace requite {
 
 requite::Scope &Context::makeScope() {
-  std::unique_ptr<requite::Scope> &scope_uptr =
-      this->_scope_uptrs.emplace_back(std::make_unique<requite::Scope>());
-  requite::Scope &scope = requite::getRef(scope_uptr);
-  return scope;
+  return this->getThreadSymbolPools()._scope_pool.make();
 }
 
 requite::Table &Context::makeTable() {
-  std::unique_ptr<requite::Table> &table_uptr =
-      this->_table_uptrs.emplace_back(std::make_unique<requite::Table>());
-  return requite::getRef(table_uptr);
+  return this->getThreadSymbolPools()._table_pool.make();
 }
 
 requite::Object &Context::makeObject() {
-  std::unique_ptr<requite::Object> &object_uptr =
-      this->_object_uptrs.emplace_back(std::make_unique<requite::Object>());
-  return requite::getRef(object_uptr);
+  return this->getThreadSymbolPools()._object_pool.make();
 }
 
 requite::NamedProcedureGroup &Context::makeNamedProcedureGroup() {
-  std::unique_ptr<requite::NamedProcedureGroup> &procedure_uptr =
-      this->_named_procedure_group_uptrs.emplace_back(
-          std::make_unique<requite::NamedProcedureGroup>());
-  return requite::getRef(procedure_uptr);
+  return this->getThreadSymbolPools()._named_procedure_group_pool.make();
 }
 
 requite::Procedure &Context::makeProcedure() {
-  std::unique_ptr<requite::Procedure> &procedure_uptr =
-      this->_procedure_uptrs.emplace_back(
-          std::make_unique<requite::Procedure>());
-  return requite::getRef(procedure_uptr);
+  return this->getThreadSymbolPools()._procedure_pool.make();
 }
 
 requite::Alias &Context::makeAlias() {
-  std::unique_ptr<requite::Alias> &alias_uptr =
-      this->_alias_uptrs.emplace_back(std::make_unique<requite::Alias>());
-  return requite::getRef(alias_uptr);
+  return this->getThreadSymbolPools()._alias_pool.make();
 }
 
 requite::OrderedVariable &Context::makeOrderedVariable() {
-  std::unique_ptr<requite::OrderedVariable> &ordered_variable_uptr =
-      this->_ordered_variable_uptrs.emplace_back(std::make_unique<requite::OrderedVariable>());
-  return requite::getRef(ordered_variable_uptr);
+  return this->getThreadSymbolPools()._ordered_variable_pool.make();
 }
 
 requite::UnorderedVariable &Context::makeUnorderedVariable() {
-  std::unique_ptr<requite::UnorderedVariable> &unordered_variable_uptr =
-      this->_unordered_variable_uptrs.emplace_back(std::make_unique<requite::UnorderedVariable>());
-  return requite::getRef(unordered_variable_uptr);
+  return this->getThreadSymbolPools()._unordered_variable_pool.make();
 }
 
 requite::AnonymousFunction &Context::makeAnonymousFunction() {
-  std::unique_ptr<requite::AnonymousFunction> &anonymous_function_uptr =
-      this->_anonymous_function_uptrs.emplace_back(
-          std::make_unique<requite::AnonymousFunction>());
-  return requite::getRef(anonymous_function_uptr);
+  return this->getThreadSymbolPools()._anonymous_function_pool.make();
 }
 
 requite::Label &Context::makeLabel() {
-  std::unique_ptr<requite::Label> &label_uptr =
-      this->_label_uptrs.emplace_back(std::make_unique<requite::Label>());
-  return requite::getRef(label_uptr);
-}
-
-std::vector<std::unique_ptr<requite::Scope>> &Context::getScopeUptrs() {
-  return this->_scope_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::Scope>> &
-Context::getScopeUptrs() const {
-  return this->_scope_uptrs;
-}
-
-std::vector<std::unique_ptr<requite::Table>> &Context::getTableUptrs() {
-  return this->_table_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::Table>> &
-Context::getTableUptrs() const {
-  return this->_table_uptrs;
-}
-
-std::vector<std::unique_ptr<requite::Object>> &Context::getObjectUptrs() {
-  return this->_object_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::Object>> &
-Context::getObjectUptrs() const {
-  return this->_object_uptrs;
-}
-
-std::vector<std::unique_ptr<requite::NamedProcedureGroup>> &
-Context::getNamedProcedureGroupUptrs() {
-  return this->_named_procedure_group_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::NamedProcedureGroup>> &
-Context::getNamedProcedureGroupUptrs() const {
-  return this->_named_procedure_group_uptrs;
-}
-
-std::vector<std::unique_ptr<requite::Procedure>> &Context::getProcedureUptrs() {
-  return this->_procedure_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::Procedure>> &
-Context::getProcedureUptrs() const {
-  return this->_procedure_uptrs;
-}
-
-std::vector<std::unique_ptr<requite::Alias>> &Context::getAliasUptrs() {
-  return this->_alias_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::Alias>> &
-Context::getAliasUptrs() const {
-  return this->_alias_uptrs;
-}
-
-std::vector<std::unique_ptr<requite::OrderedVariable>> &Context::getOrderedVariableUptrs() {
-  return this->_ordered_variable_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::OrderedVariable>> &
-Context::getOrderedVariableUptrs() const {
-  return this->_ordered_variable_uptrs;
-}
-
-std::vector<std::unique_ptr<requite::UnorderedVariable>> &Context::getUnorderedVariableUptrs() {
-  return this->_unordered_variable_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::UnorderedVariable>> &
-Context::getUnorderedVariableUptrs() const {
-  return this->_unordered_variable_uptrs;
-}
-
-std::vector<std::unique_ptr<requite::AnonymousFunction>> &
-Context::getAnonymousFunctionUptrs() {
-  return this->_anonymous_function_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::AnonymousFunction>> &
-Context::getAnonymousFunctionUptrs() const {
-  return this->_anonymous_function_uptrs;
-}
-
-std::vector<std::unique_ptr<requite::Label>> &Context::getLabelUptrs() {
-  return this->_label_uptrs;
-}
-
-const std::vector<std::unique_ptr<requite::Label>> &
-Context::getLabelUptrs() const {
-  return this->_label_uptrs;
+  return this->getThreadSymbolPools()._label_pool.make();
+}
+
+requite::SymbolPools &Context::getThreadSymbolPools() {
+  thread_local std::uint64_t cached_id = 0;
+  thread_local requite::SymbolPools *cached_pools_ptr = nullptr;
+  if (cached_id == this->_symbol_pools_id) {
+    return requite::getRef(cached_pools_ptr);
+  }
+  std::scoped_lock guard(this->_symbol_pools_mutex);
+  cached_pools_ptr =
+      this->_symbol_pools_uptrs
+          .emplace_back(std::make_unique<requite::SymbolPools>())
+          .get();
+  cached_id = this->_symbol_pools_id;
+  return requite::getRef(cached_pools_ptr);
 }
 
 } // namespace requite
\ No newline at end of file
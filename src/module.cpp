@@ -2,13 +2,18 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <requite/expression.hpp>
 #include <requite/module.hpp>
 #include <requite/procedure.hpp>
 
+#include <llvm/Support/StringSaver.h>
+
 namespace requite {
 
 Module::Module() { this->getScope().setModule(*this); }
 
+Module::~Module() = default;
+
 bool Module::operator==(const Self &rhs) const { return this == &rhs; }
 
 bool Module::operator!=(const Self &rhs) const { return this != &rhs; }
@@ -97,4 +102,19 @@ const requite::Procedure &Module::getEntryPoint() const {
   return requite::getRef(this->_entry_point_ptr);
 }
 
+requite::Fingerprint &Module::getFingerprint() { return this->_fingerprint; }
+
+const requite::Fingerprint &Module::getFingerprint() const {
+  return this->_fingerprint;
+}
+
+llvm::StringRef Module::saveText(llvm::StringRef text) {
+  std::lock_guard lock(this->_text_mutex);
+  return llvm::StringSaver(this->_text_allocator).save(text);
+}
+
+bool Module::getIsTabulated() const { return this->_is_tabulated; }
+
+void Module::setIsTabulated() { this->_is_tabulated = true; }
+
 } // namespace requite
\ No newline at end of file
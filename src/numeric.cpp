@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include <requite/numeric.hpp>
+
+#include <llvm/ADT/APInt.h>
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace requite {
+
+// The decimal to binary conversion below follows the Eisel-Lemire algorithm
+// as described in "Number Parsing at a Gigabyte per Second" (Lemire 2021). A
+// significand of at most 19 decimal digits is multiplied by a 128 bit
+// approximation of the power of five, which is enough to round correctly in
+// almost every case. The rare cases it cannot decide are reported so that the
+// caller falls back to llvm::APFloat.
+
+static constexpr int SMALLEST_POWER_OF_FIVE = -342;
+static constexpr int LARGEST_POWER_OF_FIVE = 308;
+static constexpr unsigned POWER_OF_FIVE_COUNT =
+    LARGEST_POWER_OF_FIVE - SMALLEST_POWER_OF_FIVE + 1;
+
+struct FastRealFormat final {
+  int _mantissa_explicit_bits;
+  int _minimum_exponent;
+  int _infinite_power;
+  int _smallest_power_of_ten;
+  int _largest_power_of_ten;
+  int _min_exponent_round_to_even;
+  int _max_exponent_round_to_even;
+  unsigned _depth;
+  const llvm::fltSemantics &(*_get_semantics)();
+};
+
+static constexpr requite::FastRealFormat HALF_FORMAT = {
+    10, -15, 0x1F, -27, 4, -22, 5, 16, &llvm::APFloat::IEEEhalf};
+
+static constexpr requite::FastRealFormat SINGLE_FORMAT = {
+    23, -127, 0xFF, -64, 38, -17, 10, 32, &llvm::APFloat::IEEEsingle};
+
+static constexpr requite::FastRealFormat DOUBLE_FORMAT = {
+    52,  -1023, 0x7FF, SMALLEST_POWER_OF_FIVE, LARGEST_POWER_OF_FIVE,
+    -4,  23,    64,    &llvm::APFloat::IEEEdouble};
+
+struct Product128 final {
+  std::uint64_t _low = 0;
+  std::uint64_t _high = 0;
+};
+
+[[nodiscard]] static const std::array<std::uint64_t, POWER_OF_FIVE_COUNT * 2> &
+getPowersOfFive() {
+  // Each entry is the power of five normalized so that its most significant
+  // bit is the top bit of 128 bits. Positive powers are truncated. Negative
+  // powers are reciprocals rounded up, and for the small negative powers
+  // where a literal can fall exactly between two values the reciprocal is
+  // computed directly at 128 bits so that it never underestimates.
+  static const std::array<std::uint64_t, POWER_OF_FIVE_COUNT * 2> TABLE = [] {
+    std::array<std::uint64_t, POWER_OF_FIVE_COUNT * 2> table = {};
+    constexpr unsigned work_depth = 2048;
+    for (int q = SMALLEST_POWER_OF_FIVE; q <= LARGEST_POWER_OF_FIVE; ++q) {
+      llvm::APInt power(work_depth, 1);
+      for (int power_i = 0; power_i < (q < 0 ? -q : q); ++power_i) {
+        power *= 5;
+      }
+      llvm::APInt normalized = power;
+      if (q < 0) {
+        const unsigned z = power.getActiveBits();
+        const unsigned b = q >= -27 ? z + 127 : 2 * z + 128;
+        normalized = llvm::APInt::getOneBitSet(work_depth, b).udiv(power) + 1;
+      }
+      const unsigned active_bits = normalized.getActiveBits();
+      if (active_bits > 128) {
+        normalized.lshrInPlace(active_bits - 128);
+      } else {
+        normalized <<= 128 - active_bits;
+      }
+      const unsigned entry_i = 2 * (q - SMALLEST_POWER_OF_FIVE);
+      table[entry_i] = normalized.extractBitsAsZExtValue(64, 64);
+      table[entry_i + 1] = normalized.extractBitsAsZExtValue(64, 0);
+    }
+    return table;
+  }();
+  return TABLE;
+}
+
+[[nodiscard]] static requite::Product128 multiplyFull(std::uint64_t lhs,
+                                                      std::uint64_t rhs) {
+  const std::uint64_t lhs_low = lhs & 0xFFFFFFFF;
+  const std::uint64_t lhs_high = lhs >> 32;
+  const std::uint64_t rhs_low = rhs & 0xFFFFFFFF;
+  const std::uint64_t rhs_high = rhs >> 32;
+  const std::uint64_t low_low = lhs_low * rhs_low;
+  const std::uint64_t low_high = lhs_low * rhs_high;
+  const std::uint64_t high_low = lhs_high * rhs_low;
+  const std::uint64_t high_high = lhs_high * rhs_high;
+  const std::uint64_t middle =
+      (low_low >> 32) + (low_high & 0xFFFFFFFF) + (high_low & 0xFFFFFFFF);
+  requite::Product128 product;
+  product._low = (middle << 32) | (low_low & 0xFFFFFFFF);
+  product._high = high_high + (low_high >> 32) + (high_low >> 32) +
+                  (middle >> 32);
+  return product;
+}
+
+[[nodiscard]] static requite::Product128
+getProductApproximation(int q, std::uint64_t w, int bit_precision) {
+  const auto &powers = requite::getPowersOfFive();
+  const unsigned entry_i = 2 * (q - SMALLEST_POWER_OF_FIVE);
+  const std::uint64_t precision_mask =
+      std::numeric_limits<std::uint64_t>::max() >> bit_precision;
+  requite::Product128 first = requite::multiplyFull(w, powers[entry_i]);
+  // Only when the bits that decide the rounding are all ones can the lower
+  // half of the power change the result.
+  if ((first._high & precision_mask) == precision_mask) {
+    const requite::Product128 second =
+        requite::multiplyFull(w, powers[entry_i + 1]);
+    first._low += second._high;
+    if (second._high > first._low) {
+      ++first._high;
+    }
+  }
+  return first;
+}
+
+[[nodiscard]] static int getBinaryPower(int q) {
+  return (((152170 + 65536) * q) >> 16) + 63;
+}
+
+bool getFastRealValue(std::uint64_t significand, int exponent,
+                      requite::FloatSemantics semantics,
+                      llvm::APFloat &out_value) {
+  const requite::FastRealFormat *format_ptr = nullptr;
+  switch (semantics) {
+  case requite::FloatSemantics::BINARY_HALF:
+    format_ptr = &HALF_FORMAT;
+    break;
+  case requite::FloatSemantics::BINARY_SINGLE:
+    format_ptr = &SINGLE_FORMAT;
+    break;
+  case requite::FloatSemantics::BINARY_DOUBLE:
+    format_ptr = &DOUBLE_FORMAT;
+    break;
+  default:
+    return false;
+  }
+  const requite::FastRealFormat &format = *format_ptr;
+  const int mantissa_bits = format._mantissa_explicit_bits;
+  std::uint64_t mantissa = 0;
+  int power2 = 0;
+  if (significand == 0 || exponent < format._smallest_power_of_ten) {
+    mantissa = 0;
+    power2 = 0;
+  } else if (exponent > format._largest_power_of_ten) {
+    mantissa = 0;
+    power2 = format._infinite_power;
+  } else {
+    const int leading_zeros = std::countl_zero(significand);
+    significand <<= leading_zeros;
+    const requite::Product128 product =
+        requite::getProductApproximation(exponent, significand,
+                                         mantissa_bits + 3);
+    if (product._low == std::numeric_limits<std::uint64_t>::max() &&
+        (exponent < -27 || exponent > 55)) {
+      return false;
+    }
+    const int upper_bit = static_cast<int>(product._high >> 63);
+    const int shift = upper_bit + 64 - mantissa_bits - 3;
+    mantissa = product._high >> shift;
+    power2 = requite::getBinaryPower(exponent) + upper_bit - leading_zeros -
+             format._minimum_exponent;
+    if (power2 <= 0) {
+      // Half precision subnormals can land exactly between two values, which
+      // the rounding below does not break to even, so they are left to the
+      // slow path.
+      if (&format == &HALF_FORMAT) {
+        return false;
+      }
+      if (-power2 + 1 >= 64) {
+        mantissa = 0;
+        power2 = 0;
+      } else {
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        power2 = mantissa < (std::uint64_t(1) << mantissa_bits) ? 0 : 1;
+      }
+    } else {
+      // An exact tie can only occur for small powers, where the product has
+      // no bits below the rounding bit and it must be broken to even.
+      if (product._low <= 1 &&
+          exponent >= format._min_exponent_round_to_even &&
+          exponent <= format._max_exponent_round_to_even &&
+          (mantissa & 3) == 1 && (mantissa << shift) == product._high) {
+        mantissa &= ~std::uint64_t(1);
+      }
+      mantissa += mantissa & 1;
+      mantissa >>= 1;
+      if (mantissa >= (std::uint64_t(2) << mantissa_bits)) {
+        mantissa = std::uint64_t(1) << mantissa_bits;
+        ++power2;
+      }
+      mantissa &= ~(std::uint64_t(1) << mantissa_bits);
+      if (power2 >= format._infinite_power) {
+        mantissa = 0;
+        power2 = format._infinite_power;
+      }
+    }
+  }
+  const std::uint64_t bits =
+      mantissa | (static_cast<std::uint64_t>(power2) << mantissa_bits);
+  out_value =
+      llvm::APFloat(format._get_semantics(), llvm::APInt(format._depth, bits));
+  return true;
+}
+
+} // namespace requite
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include <requite/assert.hpp>
+#include <requite/object_cache.hpp>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Support/BLAKE3.h>
+#include <llvm/Support/CachePruning.h>
+#include <llvm/Support/Chrono.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <chrono>
+#include <string>
+
+namespace requite {
+
+// llvm::pruneCache only considers files with this prefix.
+static constexpr llvm::StringLiteral OBJECT_CACHE_ENTRY_PREFIX = "llvmcache-";
+
+bool ObjectCache::getIsEnabled() const { return !this->_directory.empty(); }
+
+void ObjectCache::enable(llvm::StringRef directory, std::uint64_t size_limit) {
+  REQUITE_ASSERT(!this->getIsEnabled());
+  REQUITE_ASSERT(!directory.empty());
+  this->_directory = directory.str();
+  this->_size_limit = size_limit;
+}
+
+llvm::StringRef ObjectCache::getDirectory() const {
+  REQUITE_ASSERT(this->getIsEnabled());
+  return this->_directory;
+}
+
+std::uint64_t ObjectCache::getSizeLimit() const { return this->_size_limit; }
+
+unsigned ObjectCache::getHitCount() const { return this->_hit_count; }
+
+unsigned ObjectCache::getMissCount() const { return this->_miss_count; }
+
+void ObjectCache::getKey(llvm::SmallVectorImpl<char> &out_key,
+                         const llvm::Module &module,
+                         const llvm::TargetMachine &target_machine) {
+  llvm::SmallVector<char, 0> bitcode;
+  llvm::raw_svector_ostream bitcode_ostream(bitcode);
+  llvm::WriteBitcodeToFile(module, bitcode_ostream);
+  llvm::BLAKE3 hasher;
+  hasher.update(bitcode_ostream.str());
+  // Fields are separated by a null character so that adjacent fields can not
+  // run together into the same hashed text.
+  const llvm::StringRef separator("\0", 1);
+  hasher.update(separator);
+  hasher.update(target_machine.getTargetTriple().str());
+  hasher.update(separator);
+  hasher.update(target_machine.getTargetCPU());
+  hasher.update(separator);
+  hasher.update(target_machine.getTargetFeatureString());
+  hasher.update(separator);
+  hasher.update(
+      std::to_string(static_cast<int>(target_machine.getOptLevel())));
+  out_key.clear();
+  llvm::toHex(hasher.final(), true, out_key);
+}
+
+std::unique_ptr<llvm::MemoryBuffer> ObjectCache::lookup(llvm::StringRef key) {
+  llvm::SmallString<256> entry_path;
+  this->getEntryPath(entry_path, key);
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer_eo =
+      llvm::MemoryBuffer::getFile(entry_path, false, false);
+  if (!buffer_eo) {
+    ++this->_miss_count;
+    return nullptr;
+  }
+  // Access times are unreliable on file systems mounted with noatime, so a
+  // hit touches its entry explicitly to keep the eviction order accurate.
+  int fd = -1;
+  if (!llvm::sys::fs::openFileForWrite(entry_path, fd,
+                                       llvm::sys::fs::CD_OpenExisting,
+                                       llvm::sys::fs::OF_Append)) {
+    static_cast<void>(llvm::sys::fs::setLastAccessAndModificationTime(
+        fd, std::chrono::system_clock::now()));
+    static_cast<void>(llvm::sys::Process::SafelyCloseFileDescriptor(fd));
+  }
+  ++this->_hit_count;
+  return std::move(buffer_eo.get());
+}
+
+std::error_code ObjectCache::insert(llvm::StringRef key,
+                                    llvm::StringRef object) {
+  std::error_code ec = llvm::sys::fs::create_directories(this->getDirectory());
+  if (ec) {
+    return ec;
+  }
+  // The entry is written to a temporary file first and renamed into place so
+  // that concurrent compilers never observe a partially written entry.
+  llvm::SmallString<256> temp_model = this->getDirectory();
+  llvm::sys::path::append(temp_model, llvm::Twine(OBJECT_CACHE_ENTRY_PREFIX) +
+                                          "tmp-%%%%%%%%%%%%");
+  llvm::Expected<llvm::sys::fs::TempFile> temp_e =
+      llvm::sys::fs::TempFile::create(temp_model);
+  if (!temp_e) {
+    return llvm::errorToErrorCode(temp_e.takeError());
+  }
+  {
+    llvm::raw_fd_ostream temp_ostream(temp_e->FD, false);
+    temp_ostream << object;
+    temp_ostream.flush();
+    if (temp_ostream.has_error()) {
+      ec = temp_ostream.error();
+      temp_ostream.clear_error();
+    }
+  }
+  if (ec) {
+    llvm::consumeError(temp_e->discard());
+    return ec;
+  }
+  llvm::SmallString<256> entry_path;
+  this->getEntryPath(entry_path, key);
+  if (llvm::Error error = temp_e->keep(entry_path)) {
+    return llvm::errorToErrorCode(std::move(error));
+  }
+  this->prune();
+  return {};
+}
+
+void ObjectCache::prune() const {
+  if (this->getSizeLimit() == 0) {
+    return;
+  }
+  llvm::CachePruningPolicy policy;
+  policy.Interval = std::chrono::seconds(0);
+  policy.Expiration = std::chrono::seconds(0);
+  policy.MaxSizeBytes = this->getSizeLimit();
+  static_cast<void>(llvm::pruneCache(this->getDirectory(), policy));
+}
+
+void ObjectCache::getEntryPath(llvm::SmallVectorImpl<char> &out_path,
+                               llvm::StringRef key) const {
+  out_path.clear();
+  llvm::sys::path::append(out_path, this->getDirectory(),
+                          llvm::Twine(OBJECT_CACHE_ENTRY_PREFIX) + key);
+}
+
+} // namespace requite
@@ -21,9 +21,14 @@ static llvm::cl::opt<Emit> EMIT(
     "emit", llvm::cl::desc("Choose the type of target to build."),
     llvm::cl::values(
         clEnumValN(EMIT_TOKENS, "tokens", "Output csv token data."),
+        clEnumValN(EMIT_TOKENS_BINARY, "tokens-bin",
+                   "Output binary token data."),
         clEnumValN(EMIT_PARSED, "parsed",
                    "Output intermediate requite source code of "
                    "the ast immediatly after parsing."),
+        clEnumValN(EMIT_AST_BINARY, "ast-bin",
+                   "Output a binary ast immediatly after parsing that can be "
+                   "read as a .rqast input without parsing."),
         clEnumValN(EMIT_SITUATED, "situated",
                    "Output intermediate requite source code of "
                    "the ast immediatly situating."),
@@ -51,6 +56,66 @@ static llvm::cl::opt<Form> FORM(
                    "source code.")),
     llvm::cl::init(FORM_NORMATIVE));
 
+static llvm::cl::opt<bool> INCREMENTAL(
+    "incremental",
+    llvm::cl::desc("Skip rebuilding the output file when its recorded "
+                   "fingerprint shows that nothing it depends on changed."),
+    llvm::cl::init(false));
+
+static llvm::cl::opt<bool> FUSE_TABULATION(
+    "fuse-tabulation",
+    llvm::cl::desc("Tabulate the symbols of each top-level statement as soon "
+                   "as it is situated instead of walking the module again."),
+    llvm::cl::init(false));
+
+static llvm::cl::opt<unsigned> JOBS(
+    "jobs",
+    llvm::cl::desc("Number of threads used by the passes that can run in "
+                   "parallel. 0 uses every hardware thread."),
+    llvm::cl::value_desc("<count>"), llvm::cl::init(1));
+
+static llvm::cl::opt<std::string> OBJECT_CACHE(
+    "object-cache",
+    llvm::cl::desc("Directory of a cache of emitted object files that lets "
+                   "unchanged code skip code generation."),
+    llvm::cl::value_desc("<directory>"), llvm::cl::init(""));
+
+static llvm::cl::opt<unsigned> OBJECT_CACHE_SIZE(
+    "object-cache-size",
+    llvm::cl::desc("Size in megabytes that the object cache is pruned to, "
+                   "evicting the least recently used objects first. 0 "
+                   "disables pruning."),
+    llvm::cl::value_desc("<megabytes>"), llvm::cl::init(1024));
+
+static llvm::cl::opt<bool> OBJECT_CACHE_STATS(
+    "object-cache-stats",
+    llvm::cl::desc("Print object cache hit and miss counts."),
+    llvm::cl::init(false));
+
+static llvm::cl::opt<unsigned> ERROR_LIMIT(
+    "error-limit",
+    llvm::cl::desc("Stop compiling after this many errors have been reported. "
+                   "0 reports every error."),
+    llvm::cl::value_desc("<count>"), llvm::cl::init(20));
+
+static llvm::cl::opt<DiagnosticsFormat> DIAGNOSTICS_FORMAT(
+    "diagnostics-format",
+    llvm::cl::desc("Choose how errors and other diagnostics are printed."),
+    llvm::cl::values(
+        clEnumValN(DIAGNOSTICS_FORMAT_TEXT, "text",
+                   "Print diagnostics with source snippets for people."),
+        clEnumValN(DIAGNOSTICS_FORMAT_JSON, "json",
+                   "Print one json object per diagnostic per line."),
+        clEnumValN(DIAGNOSTICS_FORMAT_SARIF, "sarif",
+                   "Print a sarif 2.1.0 log of the diagnostics.")),
+    llvm::cl::init(DIAGNOSTICS_FORMAT_TEXT));
+
+static llvm::cl::opt<bool> DIAGNOSTICS_LINE_COLUMN(
+    "diagnostics-line-column",
+    llvm::cl::desc("Include line and column numbers alongside byte offsets in "
+                   "json and sarif diagnostics."),
+    llvm::cl::init(false));
+
 llvm::StringRef getInputFilePath() { return requite::INPUT_FILE.getValue(); }
 
 llvm::StringRef getOutputFilePath() { return requite::OUTPUT_FILE.getValue(); }
@@ -59,6 +124,34 @@ requite::Emit getEmitMode() { return requite::EMIT.getValue(); }
 
 requite::Form getForm() { return requite::FORM.getValue(); }
 
+bool getIsIncremental() { return requite::INCREMENTAL.getValue(); }
+
+bool getIsTabulationFused() { return requite::FUSE_TABULATION.getValue(); }
+
+unsigned getJobCount() { return requite::JOBS.getValue(); }
+
+llvm::StringRef getObjectCacheDirectory() {
+  return requite::OBJECT_CACHE.getValue();
+}
+
+std::uint64_t getObjectCacheSizeLimitInMegabytes() {
+  return requite::OBJECT_CACHE_SIZE.getValue();
+}
+
+bool getIsObjectCacheStatsShown() {
+  return requite::OBJECT_CACHE_STATS.getValue();
+}
+
+unsigned getErrorLimit() { return requite::ERROR_LIMIT.getValue(); }
+
+requite::DiagnosticsFormat getDiagnosticsFormat() {
+  return requite::DIAGNOSTICS_FORMAT.getValue();
+}
+
+bool getIsDiagnosticsLineColumnShown() {
+  return requite::DIAGNOSTICS_LINE_COLUMN.getValue();
+}
+
 bool getIsNormativeRequiteOk() {
   return (requite::FORM.getValue() & requite::FORM_NORMATIVE) ==
          requite::FORM_NORMATIVE;
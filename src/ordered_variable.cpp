@@ -45,6 +45,21 @@ const requite::Symbol &OrderedVariable::getDataType() const {
   return this->_data_type;
 }
 
+bool OrderedVariable::getHasInternedDataType() const {
+  return !this->_interned_data_type.getIsNone();
+}
+
+void OrderedVariable::setInternedDataType(requite::TypeHandle type) {
+  REQUITE_ASSERT(!this->getHasInternedDataType());
+  REQUITE_ASSERT(!type.getIsNone());
+  this->_interned_data_type = type;
+}
+
+requite::TypeHandle OrderedVariable::getInternedDataType() const {
+  REQUITE_ASSERT(this->getHasInternedDataType());
+  return this->_interned_data_type;
+}
+
 bool OrderedVariable::getHasContaining() const {
   return this->_containing_scope_ptr != nullptr;
 }
@@ -31,56 +31,61 @@ bool Parser::getIsOk() { return this->_is_ok; }
 void Parser::setNotOk() { this->_is_ok = false; }
 
 void Parser::logErrorBinaryNoLValue(const requite::Token &token) {
-  this->getContext().logSourceMessage(
-      token, requite::LogType::ERROR,
+  this->getContext().logIdentifiedSourceMessage(
+      token, requite::LogType::ERROR, "binary-operator-without-lvalue",
       llvm::Twine("Found binary operator token of type \"") +
           requite::getName(token.getType()) + "\" with no l-value");
 }
 
 void Parser::logErrorHornedNoFirstBranch(const requite::Token &token) {
-  this->getContext().logSourceMessage(
-      token, requite::LogType::ERROR,
+  this->getContext().logIdentifiedSourceMessage(
+      token, requite::LogType::ERROR, "horned-grouping-without-first-branch",
       llvm::Twine("Found horned grouping token of type \"") +
           requite::getName(token.getType()) +
           "\" with no preceding first branch");
 }
 
 void Parser::logErrorFoundErrorToken(const requite::Token &token) {
-  this->getContext().logSourceMessage(
-      token, requite::LogType::ERROR,
+  this->getContext().logIdentifiedSourceMessage(
+      token, requite::LogType::ERROR, "error-token",
       llvm::Twine("Found error token of type \"") +
           requite::getName(token.getType()) + "\"");
 }
 
 void Parser::logErrorUnexpectedToken(const requite::Token &token) {
-  this->getContext().logSourceMessage(
-      token, requite::LogType::ERROR,
+  this->getContext().logIdentifiedSourceMessage(
+      token, requite::LogType::ERROR, "unexpected-token",
       llvm::Twine("Found unexpected token of type \"") +
           requite::getName(token.getType()) + "\"");
 }
 
 void Parser::logErrorInvalidOperatorSpacing(const requite::Token &token) {
-  this->getContext().logSourceMessage(
-      token, requite::LogType::ERROR,
+  this->getContext().logIdentifiedSourceMessage(
+      token, requite::LogType::ERROR, "invalid-operator-spacing",
       llvm::Twine("Found operator token of type \"") +
           requite::getName(token.getType()) + "\" with " +
           requite::getDescription(token.getSpacing()) + "");
 }
 
-std::string Parser::getText(llvm::StringRef log_message_type_text,
-                            const requite::Token &token,
-                            llvm::StringRef source_text) {
-  llvm::SmallString<32> buffer;
+llvm::StringRef Parser::getText(llvm::StringRef log_message_type_text,
+                                const requite::Token &token,
+                                llvm::StringRef source_text) {
+  // Most literals have no escape sequences and are referenced directly in the
+  // source buffer. Only literals that need decoding are copied, once, into
+  // the module's text arena.
+  if (source_text.find('\\') == llvm::StringRef::npos) {
+    return source_text;
+  }
+  llvm::SmallString<64> buffer;
   requite::TextResult result = requite::getTextValue(source_text, buffer);
   if (result != requite::TextResult::OK) {
-    this->getContext().logSourceMessage(
-        token, requite::LogType::ERROR,
+    this->getContext().logIdentifiedSourceMessage(
+        token, requite::LogType::ERROR, "invalid-literal-text",
         llvm::Twine("failed to parse ") + log_message_type_text + " because " +
             requite::getDescription(result) + "");
     this->setNotOk();
   }
-  const char *text = buffer.c_str();
-  return std::string(text);
+  return this->getModule().saveText(buffer);
 }
 
 requite::Module &Parser::getModule() { return this->_module_ref.get(); }
@@ -133,6 +138,10 @@ bool Parser::parseExpressions() {
   requite::Expression *previous_ptr = &this->parseExpression();
   this->getModule().setExpression(requite::getRef(previous_ptr));
   while (!this->getIsDone()) {
+    if (this->getContext().getIsErrorLimitReached()) {
+      this->setNotOk();
+      break;
+    }
     requite::Expression &next = this->parseExpression();
     requite::getRef(previous_ptr).setNext(next);
     previous_ptr = &next;
@@ -850,8 +859,9 @@ Parser::parseOperationBranches(const requite::Token &left_token,
           break;
         }
         if (trailer_token.getSourceText() != front_token.getSourceText()) {
-          this->getContext().logSourceMessage(
+          this->getContext().logIdentifiedSourceMessage(
               trailer_token, requite::LogType::ERROR,
+              "mismatched-trailer-token",
               llvm::Twine("trailer token \"") + trailer_token.getSourceText() +
                   "\" does not match front token \"" +
                   front_token.getSourceText() + "\"");
@@ -868,8 +878,9 @@ Parser::parseOperationBranches(const requite::Token &left_token,
     previous_ptr = &next;
     continue;
   }
-  this->getContext().logSourceMessage(left_token, requite::LogType::ERROR,
-                                      "Found unterminated operation");
+  this->getContext().logIdentifiedSourceMessage(
+      left_token, requite::LogType::ERROR, "unterminated-operation",
+      "Found unterminated operation");
   this->setNotOk();
   return nullptr;
 }
@@ -884,14 +895,15 @@ requite::Opcode Parser::parseOpcode() {
     opcode = this->getContext().getOpcode(token.getSourceText());
   } else {
     this->setNotOk();
-    this->getContext().logSourceMessage(token, requite::LogType::ERROR,
-                                        "opcode token not identifier literal");
+    this->getContext().logIdentifiedSourceMessage(
+        token, requite::LogType::ERROR, "opcode-not-identifier",
+        "opcode token not identifier literal");
     return requite::Opcode::__ERROR;
   }
   if (opcode == requite::Opcode::__NONE) {
     this->setNotOk();
-    this->getContext().logSourceMessage(
-        token, requite::LogType::ERROR,
+    this->getContext().logIdentifiedSourceMessage(
+        token, requite::LogType::ERROR, "unknown-opcode",
         llvm::Twine("token of type \"") + requite::getName(type) +
             "\" with text \"" + token.getSourceText() +
             "\" does not represent an opcode");
@@ -899,8 +911,8 @@ requite::Opcode Parser::parseOpcode() {
   }
   if (requite::getIsInternalUseOnly(opcode)) {
     this->setNotOk();
-    this->getContext().logSourceMessage(
-        token, requite::LogType::ERROR,
+    this->getContext().logIdentifiedSourceMessage(
+        token, requite::LogType::ERROR, "internal-opcode",
         llvm::Twine("internal use opcode not allowed: \"") +
             token.getSourceText() + "\"");
     return requite::Opcode::__ERROR;
@@ -1045,6 +1057,17 @@ requite::Expression &Parser::parseIntegerLiteral() {
   REQUITE_ASSERT(token.getType() == requite::TokenType::INTEGER_LITERAL);
   requite::Expression &integer = requite::Expression::makeInteger();
   integer.setSource(token);
+  // The value is decoded once here so that later stages never reparse the
+  // source text.
+  const requite::NumericResult result = requite::getNumericValue(
+      token.getSourceText(), integer.emplaceInteger());
+  if (result != requite::NumericResult::OK) {
+    this->getContext().logIdentifiedSourceMessage(
+        token, requite::LogType::ERROR, "invalid-integer-literal",
+        llvm::Twine("failed to parse integer literal because ") +
+            requite::getDescription(result) + "");
+    this->setNotOk();
+  }
   this->incrementToken(1);
   return integer;
 }
@@ -1065,7 +1088,7 @@ requite::Expression &Parser::parseStringLiteral() {
   REQUITE_ASSERT(token.getType() == requite::TokenType::STRING_LITERAL);
   requite::Token token_copy = token;
   token_copy.dropFrontAndBack();
-  std::string text =
+  const llvm::StringRef text =
       this->getText("string literal", token, token_copy.getSourceText());
   requite::Expression &string = requite::Expression::makeString(text);
   this->incrementToken(1);
@@ -1079,7 +1102,7 @@ requite::Expression &Parser::parseCodeunitLiteral() {
   REQUITE_ASSERT(token.getType() == requite::TokenType::CODEUNIT_LITERAL);
   requite::Token token_copy = token;
   token_copy.dropFrontAndBack();
-  std::string text =
+  const llvm::StringRef text =
       this->getText("codeunit literal", token, token_copy.getSourceText());
   requite::Expression &codeunit = requite::Expression::makeCodeunit(text);
   codeunit.setSource(token);
@@ -1141,8 +1164,9 @@ requite::Expression &Parser::parseInterpolatedString() {
       break;
     }
   }
-  this->getContext().logSourceMessage(left_token, requite::LogType::ERROR,
-                                      "Found unterminated interpolated string");
+  this->getContext().logIdentifiedSourceMessage(
+      left_token, requite::LogType::ERROR, "unterminated-interpolated-string",
+      "Found unterminated interpolated string");
   this->setNotOk();
   return requite::Expression::makeError();
 }
@@ -1190,11 +1214,11 @@ requite::Expression &Parser::parseLeftRightOperator() {
 bool Parser::checkIsNormativeRequiteOk() {
   if (!requite::getIsNormativeRequiteOk()) {
     const requite::Token &token = this->getToken();
-    this->getContext().logSourceMessage(
-        token, requite::LogType::ERROR,
+    this->getContext().logIdentifiedSourceMessage(
+        token, requite::LogType::ERROR, "normative-form-not-enabled",
         "normative requite form is not enabled.");
     this->getContext().logInputFileMessage(
-        requite::LogType::NOTE,
+        requite::LogType::NOTE, "normative-form-not-enabled",
         "normative requite can be enabled by setting the compiler flat "
         "--form=normative or --form=multiplicative.");
     this->setNotOk();
@@ -1206,11 +1230,11 @@ bool Parser::checkIsNormativeRequiteOk() {
 bool Parser::checkIsIntermediateRequiteOk() {
   if (!requite::getIsIntermediateRequiteOk()) {
     const requite::Token &token = this->getToken();
-    this->getContext().logSourceMessage(
-        token, requite::LogType::ERROR,
+    this->getContext().logIdentifiedSourceMessage(
+        token, requite::LogType::ERROR, "intermediate-form-not-enabled",
         "intermediate requite form is not enabled.");
     this->getContext().logInputFileMessage(
-        requite::LogType::NOTE,
+        requite::LogType::NOTE, "intermediate-form-not-enabled",
         "intermediate requite can be enabled by setting the compiler flat "
         "--form=intermediate or --form=multiplicative.");
     this->setNotOk();
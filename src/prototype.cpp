@@ -8,6 +8,7 @@
 #include <requite/strings.hpp>
 #include <requite/symbol.hpp>
 
+#include <atomic>
 #include <vector>
 
 namespace requite {
@@ -31,16 +32,39 @@ bool Context::prototypeEntryPoint(requite::Procedure &procedure) {
   return true;
 }
 
+bool Context::prototypeProcedures(requite::Module &module) {
+  if (!module.getHasEntryPoint()) {
+    return true;
+  }
+  requite::Procedure &entry_point = module.getEntryPoint();
+  if (!entry_point.getHasNextProcedure()) {
+    return this->prototypeEntryPoint(entry_point);
+  }
+  // prototyping a procedure only resolves the types of its own locals, so
+  // every procedure is prototyped by its own task.
+  std::atomic<bool> is_ok = true;
+  for (requite::Procedure &procedure : entry_point.getOverloadSubrange()) {
+    this->scheduleTask([this, &procedure, &is_ok] {
+      if (!this->prototypeEntryPoint(procedure)) {
+        is_ok.store(false, std::memory_order_relaxed);
+      }
+    });
+  }
+  this->waitForTasks();
+  return is_ok.load(std::memory_order_relaxed);
+}
+
 bool Context::prototypeLocal(requite::Scope &scope,
                              requite::OrderedVariable &variable) {
   REQUITE_ASSERT(variable.getType() == requite::VariableType::LOCAL);
   requite::Expression &expression = variable.getExpression();
   requite::Expression &name_expression = expression.getBranch();
   requite::Expression &value_expression = name_expression.getNext();
-  requite::Symbol &type = variable.getDataType();
+  requite::TypeHandle type;
   if (!this->inferenceTypeOfValue(type, scope, value_expression)) {
     return false;
   }
+  variable.setInternedDataType(type);
   return true;
 }
 
@@ -54,6 +78,14 @@ bool Context::prototypeProcedureBody(requite::Procedure &procedure,
     case requite::Opcode::_LOCAL:
       if (!this->prototypeLocal(scope, statement.getOrderedVariable())) {
         is_ok = false;
+        break;
+      }
+      this->foldConstantValue(scope, statement.getBranch().getNext());
+      break;
+    case requite::Opcode::EXIT:
+      // exit values are only folded once their type has been inferred.
+      if (statement.getHasBranch()) {
+        this->foldConstantValue(scope, statement.getBranch());
       }
       break;
     default:
@@ -1,4 +1,5 @@
 #include <requite/context.hpp>
+#include <requite/symbol_map.hpp>
 
 namespace requite {
 
@@ -6,27 +7,23 @@ bool Context::resolveSymbol(requite::Symbol &out_symbol, requite::Scope &scope,
                             requite::Expression &symbol_expression) {
   switch (const requite::Opcode opcode = symbol_expression.getOpcode()) {
   case requite::Opcode::__IDENTIFIER_LITERAL: {
-    for (requite::Scope &containing_scope : scope.getContainingSubrange()) {
-      requite::RootSymbol user = containing_scope.lookupInternalUserSymbol(
-          symbol_expression.getDataText());
-      if (user.getIsNone()) {
-        continue;
-      } else if (user.getIsAlias()) {
-        requite::Alias &alias = user.getAlias();
-        // if (!this->prototypeUserSymbol(alias)) {
-        //   return false;
-        // }
-        out_symbol.wrapSymbol(alias.getSymbol());
-        return true;
-      } else if (user.getIsObject()) {
-        requite::Object &object = user.getObject();
-        // if (!this->prototypeUserSymbol(object)) {
-        //   return false;
-        // }
-        out_symbol.getRoot().setType(requite::RootSymbolType::OBJECT);
-        out_symbol.getRoot().setObject(object);
-        return true;
-      }
+    const requite::HashedName name(symbol_expression.getDataText());
+    requite::RootSymbol user = scope.lookupVisibleTypeSymbol(name);
+    if (user.getIsAlias()) {
+      requite::Alias &alias = user.getAlias();
+      // if (!this->prototypeUserSymbol(alias)) {
+      //   return false;
+      // }
+      out_symbol.wrapSymbol(alias.getSymbol());
+      return true;
+    } else if (user.getIsObject()) {
+      requite::Object &object = user.getObject();
+      // if (!this->prototypeUserSymbol(object)) {
+      //   return false;
+      // }
+      out_symbol.getRoot().setType(requite::RootSymbolType::OBJECT);
+      out_symbol.getRoot().setObject(object);
+      return true;
     }
     return false;
   }
@@ -81,30 +78,87 @@ bool Context::inferenceTypeOfValue(requite::Symbol &out_symbol,
     root.setDepth(this->getAddressDepth());
     return true;
   }
-  case requite::Opcode::_ADD:
-    return this->inferenceTypeOfNaryValue(out_symbol, scope, value_expression.getBranch());
+  case requite::Opcode::_ADD: {
+    requite::TypeHandle type;
+    if (!this->inferenceTypeOfValue(type, scope, value_expression)) {
+      return false;
+    }
+    out_symbol = type.getSymbol();
+    return true;
+  }
   }
-  this->logSourceMessage(value_expression, requite::LogType::ERROR,
-                         "failed to inference type of value");
+  this->logIdentifiedSourceMessage(value_expression, requite::LogType::ERROR,
+                                   "uninferable-value-type",
+                                   "failed to inference type of value");
   return false;
 }
 
-bool Context::inferenceTypeOfNaryValue(requite::Symbol &out_symbol,
+bool Context::inferenceTypeOfValue(requite::TypeHandle &out_type,
+                                   requite::Scope &scope,
+                                   requite::Expression &value_expression) {
+  if (value_expression.getHasResolvedType()) {
+    out_type = value_expression.getResolvedType();
+    return true;
+  }
+  // Operations take the already interned type of their operands, so only
+  // leaf values build a symbol to intern.
+  if (value_expression.getOpcode() == requite::Opcode::_ADD) {
+    if (!this->inferenceTypeOfNaryValue(out_type, scope,
+                                        value_expression.getBranch())) {
+      return false;
+    }
+  } else {
+    requite::Symbol symbol;
+    if (!this->inferenceTypeOfValue(symbol, scope, value_expression)) {
+      return false;
+    }
+    out_type = this->internType(symbol);
+  }
+  value_expression.setResolvedType(out_type);
+  return true;
+}
+
+bool Context::inferenceTypeOfNaryValue(requite::TypeHandle &out_type,
                                        requite::Scope &scope,
                                        requite::Expression &first) {
+  // Operands are inferred through the memoized overload so that nested
+  // operations never infer the same subexpression twice.
+  requite::TypeHandle first_type;
+  if (!this->inferenceTypeOfValue(first_type, scope, first)) {
+    return false;
+  }
+  bool is_ok = true;
+  for (requite::Expression &operand : first.getNextSubrange()) {
+    requite::TypeHandle operand_type;
+    if (!this->inferenceTypeOfValue(operand_type, scope, operand)) {
+      is_ok = false;
+      continue;
+    }
+    if (operand_type != first_type) {
+      this->logIdentifiedSourceMessage(
+          operand, requite::LogType::ERROR, "mismatched-operand-type",
+          "operand type does not match first operand type");
+      is_ok = false;
+    }
+  }
+  if (!is_ok) {
+    return false;
+  }
+  out_type = first_type;
+  return true;
+}
 
-                                       }
-
-bool Context::resolveTypeAttributes(requite::AttributeFlags flags,
+bool Context::resolveTypeAttributes(requite::AttributeFlags &flags,
                                     requite::Expression &first) {
   bool is_ok = true;
   for (requite::Expression &attribute : first.getHorizontalSubrange()) {
     const requite::Opcode opcode = attribute.getOpcode();
     const requite::AttributeType type = requite::getAttributeType(opcode);
     if (!requite::getIsTypeAttribute(type)) {
-      this->logSourceMessage(attribute, requite::LogType::ERROR,
-                             llvm::Twine(requite::getName(type)) +
-                                 " attribute is not type attribute");
+      this->logIdentifiedSourceMessage(
+          attribute, requite::LogType::ERROR, "not-type-attribute",
+          llvm::Twine(requite::getName(type)) +
+              " attribute is not type attribute");
       is_ok = false;
       continue;
     }
@@ -18,6 +18,8 @@
 #include <requite/tuple.hpp>
 #include <requite/unordered_variable.hpp>
 
+#include <utility>
+
 namespace requite {
 
 RootSymbol::RootSymbol(const requite::RootSymbol &that)
@@ -38,6 +40,14 @@ RootSymbol::RootSymbol(const requite::RootSymbol &that)
   }
 }
 
+RootSymbol::RootSymbol(requite::RootSymbol &&that)
+    : _type(that._type), _depth(that._depth), _data_ptr(that._data_ptr) {
+  // The moved from symbol must not delete the structured data it no longer
+  // owns.
+  that._type = requite::RootSymbolType::NONE;
+  that._data_ptr = nullptr;
+}
+
 RootSymbol::~RootSymbol() {
   switch (const requite::RootSymbolType type = this->getType()) {
   case requite::RootSymbolType::SIGNATURE:
@@ -61,9 +71,19 @@ requite::RootSymbol &RootSymbol::operator=(const requite::RootSymbol &rhs) {
   return *this;
 }
 
+requite::RootSymbol &RootSymbol::operator=(requite::RootSymbol &&rhs) {
+  // Swapping hands any structured data this symbol owned to rhs, which
+  // deletes it when it is destroyed.
+  std::swap(this->_type, rhs._type);
+  std::swap(this->_depth, rhs._depth);
+  std::swap(this->_data_ptr, rhs._data_ptr);
+  return *this;
+}
+
 bool RootSymbol::operator==(const requite::RootSymbol &rhs) const {
   const bool non_data_same =
-      this->_type == rhs._type && this->_depth == rhs._depth;
+      this->_type == rhs._type &&
+      (!requite::getHasDepth(this->_type) || this->_depth == rhs._depth);
   if (!non_data_same) {
     return false;
   }
@@ -75,7 +95,7 @@ bool RootSymbol::operator==(const requite::RootSymbol &rhs) const {
   case requite::RootSymbolType::ANONYMOUS_OBJECT:
     return this->getAnonymousObject() == rhs.getAnonymousObject();
   default:
-    REQUITE_UNREACHABLE();
+    return this->_data_ptr == rhs._data_ptr;
   }
 }
 
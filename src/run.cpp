@@ -3,57 +3,124 @@
 // SPDX-License-Identifier: MIT
 
 #include <requite/assert.hpp>
+#include <requite/binary_ast.hpp>
 #include <requite/context.hpp>
 #include <requite/module.hpp>
 #include <requite/options.hpp>
 #include <requite/token.hpp>
 
 #include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/Twine.h>
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
 
 #include <vector>
 
 namespace requite {
 
 bool Context::run() {
+  this->getDiagnostics().setErrorLimit(requite::getErrorLimit());
+  if (requite::getJobCount() != 1) {
+    this->startScheduler();
+  }
+  bool is_ok = false;
+  try {
+    is_ok = this->runPasses();
+  } catch (...) {
+    // the diagnostics that led up to a failed assertion are rendered before
+    // it propagates. a scope guard would not do, since an exception with no
+    // handler does not have to unwind the stack.
+    this->waitForTasks();
+    this->renderDiagnostics();
+    throw;
+  }
+  this->renderDiagnostics();
+  return is_ok;
+}
+
+bool Context::runPasses() {
   requite::Module &source_module = this->getSourceModule();
   requite::File &source_file = source_module.getFile();
   llvm::StringRef input_path = requite::getInputFilePath();
   llvm::StringRef output_path = requite::getOutputFilePath();
-  if (!this->loadFileBuffer(source_file, input_path)) {
-    return false;
-  }
-  if (!this->validateSourceFileText(source_file)) {
+  // a binary ast was already tokenized and parsed when it was written.
+  const bool is_binary_ast_input =
+      llvm::sys::path::extension(input_path) == requite::BINARY_AST_EXTENSION;
+  if (is_binary_ast_input) {
+    if (requite::getEmitMode() == requite::EMIT_TOKENS ||
+        requite::getEmitMode() == requite::EMIT_TOKENS_BINARY) {
+      this->logMessage(
+          requite::LogType::ERROR, "tokens-from-binary-ast",
+          llvm::Twine("tokens can not be emitted from a binary ast\n\t"
+                      "path: ") +
+          llvm::Twine(input_path));
+      return false;
+    }
+    if (!this->readBinaryAst(source_module, input_path)) {
+      return false;
+    }
+  } else if (!this->loadFileBuffer(source_file, input_path)) {
     return false;
   }
-  std::vector<requite::Token> tokens = {};
-  if (!this->tokenizeTokens(this->getSourceModule(), tokens)) {
-    return false;
+  if (requite::getIsIncremental()) {
+    this->fingerprintModuleInput(source_module);
+    if (this->getIsModuleUpToDate(source_module, output_path)) {
+      return true;
+    }
+    this->removeModuleFingerprint(output_path);
   }
-  if (requite::getEmitMode() == requite::EMIT_TOKENS) {
-    if (!this->writeTokens(source_module, tokens, output_path)) {
+  if (!is_binary_ast_input) {
+    if (!this->validateSourceFileText(source_file)) {
+      return false;
+    }
+    std::vector<requite::Token> tokens = {};
+    if (!this->tokenizeTokens(this->getSourceModule(), tokens)) {
+      return false;
+    }
+    if (requite::getEmitMode() == requite::EMIT_TOKENS) {
+      if (!this->writeTokens(source_module, tokens, output_path)) {
+        return false;
+      }
+      return this->writeModuleFingerprint(source_module, output_path);
+    }
+    if (requite::getEmitMode() == requite::EMIT_TOKENS_BINARY) {
+      if (!this->writeBinaryTokens(source_module, tokens, output_path)) {
+        return false;
+      }
+      return this->writeModuleFingerprint(source_module, output_path);
+    }
+    this->createOpcodeTable();
+    if (!this->parseAst(source_module, tokens)) {
       return false;
     }
-    return true;
-  }
-  this->createOpcodeTable();
-  if (!this->parseAst(source_module, tokens)) {
-    return false;
   }
   if (requite::getEmitMode() == requite::EMIT_PARSED) {
     if (!this->writeAst(source_module, output_path)) {
       return false;
     }
-    return true;
+    return this->writeModuleFingerprint(source_module, output_path);
   }
-  if (!this->situateAst(source_module)) {
+  if (requite::getEmitMode() == requite::EMIT_AST_BINARY) {
+    if (!this->writeBinaryAst(source_module, output_path)) {
+      return false;
+    }
+    return this->writeModuleFingerprint(source_module, output_path);
+  }
+  // situated output is written before any symbols are tabulated, so the
+  // fused pass is only taken when the pipeline continues past it.
+  if (requite::getIsTabulationFused() &&
+      requite::getEmitMode() != requite::EMIT_SITUATED) {
+    if (!this->situateAndTabulateAst(source_module)) {
+      return false;
+    }
+  } else if (!this->situateAst(source_module)) {
     return false;
   }
   if (requite::getEmitMode() == requite::EMIT_SITUATED) {
     if (!this->writeAst(source_module, output_path)) {
       return false;
     }
-    return true;
+    return this->writeModuleFingerprint(source_module, output_path);
   }
   if (!this->determineModuleName(source_module)) {
     return false;
@@ -68,13 +135,13 @@ bool Context::run() {
     if (!this->writeAst(source_module, output_path)) {
       return false;
     }
-    return true;
+    return this->writeModuleFingerprint(source_module, output_path);
   }
   if (requite::getEmitMode() == requite::EMIT_SYMBOLS) {
     if (!this->writeUserSymbols(output_path)) {
       return false;
     }
-    return true;
+    return this->writeModuleFingerprint(source_module, output_path);
   }
   if (!this->checkEntryPointCount()) {
     return false;
@@ -86,19 +153,20 @@ bool Context::run() {
     if (!this->writeLlvmIr(output_path)) {
       return false;
     }
-    return true;
+    return this->writeModuleFingerprint(source_module, output_path);
   }
   if (requite::getEmitMode() == requite::EMIT_ASSEMBLY) {
     if (!this->writeAssembly(output_path)) {
       return false;
     }
-    return true;
+    return this->writeModuleFingerprint(source_module, output_path);
   }
   if (requite::getEmitMode() == requite::EMIT_OBJECT) {
+    this->initializeObjectCache();
     if (!this->writeObject(output_path)) {
       return false;
     }
-    return true;
+    return this->writeModuleFingerprint(source_module, output_path);
   }
   return true;
 }
@@ -37,11 +37,11 @@ const requite::Module &Scope::getModule() const {
 
 requite::ScopeType Scope::getType() const { return this->_type; }
 
-llvm::StringMap<requite::RootSymbol> &Scope::getInternalSymbolMap() {
+requite::SymbolMap &Scope::getInternalSymbolMap() {
   return this->_internal_symbol_map;
 }
 
-const llvm::StringMap<requite::RootSymbol> &Scope::getInternalSymbolMap() const {
+const requite::SymbolMap &Scope::getInternalSymbolMap() const {
   return this->_internal_symbol_map;
 }
 
@@ -52,6 +52,7 @@ bool Scope::getHasContaining() const {
 void Scope::setContaining(requite::Scope &scope) {
   requite::setSingleRef(this->_containing_scope_ptr, scope);
   this->_scope_depth = scope.getScopeDepth();
+  requite::Scope::advanceSymbolGeneration();
 }
 
 requite::Scope &Scope::getContaining() {
@@ -95,7 +96,7 @@ const requite::ExportTable &Scope::getExportTable() const {
 }
 
 bool Scope::getIsEmpty() const {
-  return this->getInternalSymbolMap().empty() && this->getNodes().empty() &&
+  return this->getInternalSymbolMap().getIsEmpty() && this->getNodes().empty() &&
          !this->getHasExportTable();
 }
 
@@ -9,6 +9,9 @@
 #include <requite/module.hpp>
 #include <requite/opcode.hpp>
 #include <requite/situator.hpp>
+#include <requite/utility.hpp>
+
+#include <vector>
 
 namespace requite {
 
@@ -19,6 +22,12 @@ bool Context::situateAst(requite::Module &module) {
   return is_ok;
 }
 
+bool Context::situateAndTabulateAst(requite::Module &module) {
+  requite::Situator situator(*this, module);
+  const bool is_ok = situator.situateAndTabulateAst();
+  return is_ok;
+}
+
 Situator::Situator(requite::Context &context, requite::Module &module)
     : _context_ref(context), _module_ref(module), _is_ok(true) {}
 
@@ -44,7 +53,107 @@ bool Situator::situateAst() {
   this->insertModuleRoot();
   requite::Expression &root = this->getModule().getExpression();
   REQUITE_ASSERT(root.getOpcode() == requite::Opcode::MODULE);
-  this->situateExpression<requite::Situation::ROOT_STATEMENT>(root);
+  if (this->getContext().getHasScheduler()) {
+    this->situateModuleInParallel(root);
+  } else {
+    this->situateExpression<requite::Situation::ROOT_STATEMENT>(root);
+  }
+  return this->getIsOk();
+}
+
+void Situator::situateModuleInParallel(requite::Expression &root) {
+  requite::Context &context = this->getContext();
+  requite::Module &module = this->getModule();
+  static constexpr requite::Situation STATEMENT_SITUATION =
+      requite::getNextScopeStatementSituation<
+          requite::Situation::ROOT_STATEMENT>();
+  // situating an assert looks up its line, and llvm::SourceMgr builds the
+  // line offsets of a buffer on its first lookup. building them here leaves
+  // the tasks only reading them.
+  static_cast<void>(context.getSourceStartLocation(root));
+  // top-level statements only change their own subtrees, so each one is
+  // situated by its own task with its own situator to record errors in.
+  std::vector<requite::Expression *> statement_ptrs = {};
+  requite::ExpressionWalkResult result =
+      root.walkBranch()
+          .doOne([&](requite::Expression &name) {
+            this->situateBranch<requite::Situation::SYMBOL_NAME>(
+                "first branch", root, 0, name);
+          })
+          .doAll([&](requite::Expression &statement) {
+            statement_ptrs.push_back(&statement);
+          });
+  if (!result.getWalkedAtLeast(1)) {
+    context.logNotAtLeastBranchCount<requite::Situation::ROOT_STATEMENT>(root,
+                                                                       1);
+    this->setNotOk();
+  }
+  std::vector<requite::Situator> statement_situators = {};
+  statement_situators.reserve(statement_ptrs.size());
+  for (unsigned statement_i = 0; statement_i < statement_ptrs.size();
+       ++statement_i) {
+    requite::Situator &situator =
+        statement_situators.emplace_back(context, module);
+    requite::Expression &statement =
+        requite::getRef(statement_ptrs[statement_i]);
+    context.scheduleTask([&situator, &root, &statement, statement_i] {
+      situator.situateBranch<STATEMENT_SITUATION>(
+          "second and subsequent branches", root, statement_i + 1, statement);
+    });
+  }
+  context.waitForTasks();
+  for (const requite::Situator &situator : statement_situators) {
+    if (!situator.getIsOk()) {
+      this->setNotOk();
+    }
+  }
+}
+
+bool Situator::situateAndTabulateAst() {
+  this->insertModuleRoot();
+  requite::Module &module = this->getModule();
+  requite::Expression &root = module.getExpression();
+  REQUITE_ASSERT(root.getOpcode() == requite::Opcode::MODULE);
+  static constexpr requite::Situation STATEMENT_SITUATION =
+      requite::getNextScopeStatementSituation<
+          requite::Situation::ROOT_STATEMENT>();
+  requite::ExpressionWalkResult result =
+      root.walkBranch()
+          .doOne([&](requite::Expression &name) {
+            this->situateBranch<requite::Situation::SYMBOL_NAME>(
+                "first branch", root, 0, name);
+          })
+          .doAll([&](unsigned statement_i, requite::Expression &statement) {
+            // a statement is tabulated while its subtree is still warm, but
+            // only if it situated cleanly on its own.
+            const bool was_ok = this->getIsOk();
+            this->setIsOk();
+            this->situateBranch<STATEMENT_SITUATION>(
+                "second and subsequent branches", root, statement_i,
+                statement);
+            if (this->getIsOk()) {
+              requite::Context &context = this->getContext();
+              if (!context.tabulateModuleStatement(module, statement)) {
+                this->setNotOk();
+              } else if (statement.getOpcode() ==
+                             requite::Opcode::ENTRY_POINT &&
+                         !context.tabulateProcedure(
+                             module, statement.getProcedure())) {
+                this->setNotOk();
+              }
+            }
+            if (!was_ok) {
+              this->setNotOk();
+            }
+          });
+  if (!result.getWalkedAtLeast(1)) {
+    this->getContext()
+        .logNotAtLeastBranchCount<requite::Situation::ROOT_STATEMENT>(root, 1);
+    this->setNotOk();
+  }
+  if (this->getIsOk()) {
+    module.setIsTabulated();
+  }
   return this->getIsOk();
 }
 
@@ -77,4 +186,4 @@ void Situator::insertModuleRoot() {
   }
 }
 
-} // namespace requite
\ No newline at end of file
+} // namespace requite
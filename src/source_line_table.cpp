@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include <requite/assert.hpp>
+#include <requite/source_line_table.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace requite {
+
+SourceLineTable::SourceLineTable(llvm::StringRef identifier,
+                                 llvm::StringRef text)
+    : _identifier(identifier), _text(text) {
+  this->_line_offsets.push_back(0);
+  const char *const begin = text.begin();
+  const char *const end = text.end();
+  for (const char *it = begin; it != end;) {
+    const void *newline_ptr = std::memchr(it, '\n', end - it);
+    if (newline_ptr == nullptr) {
+      break;
+    }
+    it = static_cast<const char *>(newline_ptr) + 1;
+    this->_line_offsets.push_back(static_cast<std::uint32_t>(it - begin));
+  }
+}
+
+unsigned SourceLineTable::getLineCount() const {
+  return static_cast<unsigned>(this->_line_offsets.size());
+}
+
+bool SourceLineTable::getHasLocation(const char *text_ptr) const {
+  return text_ptr >= this->_text.begin() && text_ptr <= this->_text.end();
+}
+
+requite::SourceLocation SourceLineTable::getLocation(const char *text_ptr) {
+  REQUITE_ASSERT(this->getHasLocation(text_ptr));
+  const std::uint32_t offset =
+      static_cast<std::uint32_t>(text_ptr - this->_text.begin());
+  const std::vector<std::uint32_t> &offsets = this->_line_offsets;
+  std::uint32_t line_i = this->_last_line_i;
+  const auto getIsOnLine = [&offsets, offset](std::uint32_t line_i) {
+    return offsets[line_i] <= offset &&
+           (line_i + 1 == offsets.size() || offset < offsets[line_i + 1]);
+  };
+  if (!getIsOnLine(line_i)) {
+    if (line_i + 1 < offsets.size() && getIsOnLine(line_i + 1)) {
+      ++line_i;
+    } else {
+      line_i = static_cast<std::uint32_t>(
+          std::upper_bound(offsets.begin(), offsets.end(), offset) -
+          offsets.begin() - 1);
+    }
+  }
+  this->_last_line_i = line_i;
+  requite::SourceLocation location = {};
+  location.file = this->_identifier;
+  location.line = line_i + 1;
+  location.column = offset - offsets[line_i] + 1;
+  return location;
+}
+
+} // namespace requite
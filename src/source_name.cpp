@@ -18,8 +18,9 @@ bool Context::determineModuleName(requite::Module &module) {
   requite::Expression &root = module.getExpression();
   requite::Expression &name_expression = root.getBranch();
   if (!name_expression.getIsIdentifier()) {
-    this->logSourceMessage(name_expression, requite::LogType::ERROR,
-                           "module name is not instantly determinable");
+    this->logIdentifiedSourceMessage(
+        name_expression, requite::LogType::ERROR, "non-instant-module-name",
+        "module name is not instantly determinable");
     return false;
   }
   llvm::StringRef name = name_expression.getDataText();
@@ -15,11 +15,13 @@ Symbol::Symbol(requite::RootSymbol &root,
     : _root(root), _subs(subs.begin(), subs.end()) {}
 
 bool Symbol::operator==(const requite::Symbol &rhs) const {
-  return rhs._root == this->_root && rhs._subs == this->_subs;
+  return rhs._root == this->_root &&
+         rhs._root_attributes == this->_root_attributes &&
+         rhs._subs == this->_subs;
 }
 
 bool Symbol::operator!=(const requite::Symbol &rhs) const {
-  return rhs._root != this->_root || rhs._subs != this->_subs;
+  return !(*this == rhs);
 }
 
 bool Symbol::getIsEmpty() const {
@@ -39,9 +41,11 @@ const requite::AttributeFlags &Symbol::getRootAttributeFlags() const {
   return this->_root_attributes;
 }
 
-std::vector<requite::SubSymbol> &Symbol::getSubs() { return this->_subs; }
+llvm::SmallVectorImpl<requite::SubSymbol> &Symbol::getSubs() {
+  return this->_subs;
+}
 
-const std::vector<requite::SubSymbol> &Symbol::getSubs() const {
+const llvm::SmallVectorImpl<requite::SubSymbol> &Symbol::getSubs() const {
   return this->_subs;
 }
 
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include <requite/assert.hpp>
+#include <requite/symbol_map.hpp>
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/MathExtras.h>
+#include <llvm/Support/xxhash.h>
+
+#include <algorithm>
+
+namespace requite {
+
+HashedName::HashedName(llvm::StringRef text)
+    : _text(text), _hash(llvm::xxh3_64bits(llvm::arrayRefFromStringRef(text))) {
+}
+
+llvm::StringRef HashedName::getText() const { return this->_text; }
+
+std::uint64_t HashedName::getHash() const { return this->_hash; }
+
+llvm::StringRef SymbolMapEntry::getName() const { return this->_name; }
+
+std::uint64_t SymbolMapEntry::getHash() const { return this->_hash; }
+
+requite::RootSymbol &SymbolMapEntry::getSymbol() { return this->_symbol; }
+
+const requite::RootSymbol &SymbolMapEntry::getSymbol() const {
+  return this->_symbol;
+}
+
+bool SymbolMap::getIsEmpty() const { return this->_entries.empty(); }
+
+unsigned SymbolMap::getSize() const {
+  return static_cast<unsigned>(this->_entries.size());
+}
+
+bool SymbolMap::getHasName(const requite::HashedName &name) const {
+  return this->find(name) != nullptr;
+}
+
+requite::RootSymbol *SymbolMap::find(const requite::HashedName &name) {
+  return const_cast<requite::RootSymbol *>(
+      static_cast<const Self &>(*this).find(name));
+}
+
+const requite::RootSymbol *
+SymbolMap::find(const requite::HashedName &name) const {
+  if (this->_slots.empty()) {
+    return nullptr;
+  }
+  const std::uint32_t slot = this->_slots[this->findSlot(name)];
+  if (slot == Self::EMPTY_SLOT) {
+    return nullptr;
+  }
+  return &this->_entries[slot - 1].getSymbol();
+}
+
+bool SymbolMap::insert(const requite::HashedName &name,
+                       requite::RootSymbol &&symbol) {
+  REQUITE_ASSERT(!name.getText().empty());
+  // Keep the load factor at or below three quarters so probe sequences stay
+  // short.
+  if ((this->_entries.size() + 1) * 4 > this->_slots.size() * 3) {
+    this->grow();
+  }
+  const unsigned slot_i = this->findSlot(name);
+  if (this->_slots[slot_i] != Self::EMPTY_SLOT) {
+    return false;
+  }
+  Entry &entry = this->_entries.emplace_back();
+  entry._name = name.getText().str();
+  entry._hash = name.getHash();
+  entry._symbol = std::move(symbol);
+  this->_slots[slot_i] = static_cast<std::uint32_t>(this->_entries.size());
+  return true;
+}
+
+void SymbolMap::clear() {
+  this->_entries.clear();
+  std::fill(this->_slots.begin(), this->_slots.end(), Self::EMPTY_SLOT);
+}
+
+std::vector<SymbolMap::Entry>::const_iterator SymbolMap::begin() const {
+  return this->_entries.begin();
+}
+
+std::vector<SymbolMap::Entry>::const_iterator SymbolMap::end() const {
+  return this->_entries.end();
+}
+
+unsigned SymbolMap::findSlot(const requite::HashedName &name) const {
+  REQUITE_ASSERT(llvm::isPowerOf2_64(this->_slots.size()));
+  const std::uint64_t mask = this->_slots.size() - 1;
+  std::uint64_t slot_i = name.getHash() & mask;
+  while (true) {
+    const std::uint32_t slot = this->_slots[slot_i];
+    if (slot == Self::EMPTY_SLOT) {
+      return static_cast<unsigned>(slot_i);
+    }
+    const Entry &entry = this->_entries[slot - 1];
+    if (entry.getHash() == name.getHash() &&
+        entry.getName() == name.getText()) {
+      return static_cast<unsigned>(slot_i);
+    }
+    slot_i = (slot_i + 1) & mask;
+  }
+}
+
+void SymbolMap::grow() {
+  const std::size_t slot_count =
+      this->_slots.empty() ? Self::MINIMUM_SLOT_COUNT : this->_slots.size() * 2;
+  this->_slots.assign(slot_count, Self::EMPTY_SLOT);
+  const std::uint64_t mask = slot_count - 1;
+  for (std::uint32_t entry_i = 0; entry_i < this->_entries.size(); ++entry_i) {
+    std::uint64_t slot_i = this->_entries[entry_i].getHash() & mask;
+    while (this->_slots[slot_i] != Self::EMPTY_SLOT) {
+      slot_i = (slot_i + 1) & mask;
+    }
+    this->_slots[slot_i] = entry_i + 1;
+  }
+}
+
+} // namespace requite
@@ -1,10 +1,78 @@
+#include <requite/assert.hpp>
 #include <requite/context.hpp>
 #include <requite/expression.hpp>
 #include <requite/ordered_variable.hpp>
 #include <requite/scope.hpp>
+#include <requite/unreachable.hpp>
+
+#include <atomic>
 
 namespace requite {
 
+bool Context::tabulateModuleStatement(requite::Module &module,
+                                      requite::Expression &statement) {
+  switch (const requite::Opcode opcode = statement.getOpcode()) {
+  case requite::Opcode::_ASCRIBE_FIRST_BRANCH: {
+    requite::Expression &ascribed = statement.getBranch();
+    switch (const requite::Opcode ascribed_opcode = ascribed.getOpcode()) {
+    case requite::Opcode::ENTRY_POINT:
+      this->logErrorMustNotHaveAttributeFlags(ascribed);
+      return false;
+    case requite::Opcode::FUNCTION:
+      this->logNotSupportedYet(statement);
+      return false;
+    case requite::Opcode::GLOBAL:
+      this->logNotSupportedYet(statement);
+      return false;
+    case requite::Opcode::OBJECT:
+      this->logNotSupportedYet(statement);
+      return false;
+    case requite::Opcode::TABLE:
+      this->logNotSupportedYet(statement);
+      return false;
+    case requite::Opcode::IMPORT:
+      this->logNotSupportedYet(statement);
+      return false;
+    case requite::Opcode::USE:
+      this->logNotSupportedYet(statement);
+      return false;
+    case requite::Opcode::_EXPAND_VALUE:
+      this->logNotSupportedYet(statement);
+      return false;
+    default:
+      break;
+    }
+    break;
+  }
+  case requite::Opcode::ENTRY_POINT:
+    return this->tabulateEntryPoint(module, statement);
+  case requite::Opcode::FUNCTION:
+    this->logNotSupportedYet(statement);
+    return false;
+  case requite::Opcode::GLOBAL:
+    this->logNotSupportedYet(statement);
+    return false;
+  case requite::Opcode::OBJECT:
+    this->logNotSupportedYet(statement);
+    return false;
+  case requite::Opcode::TABLE:
+    this->logNotSupportedYet(statement);
+    return false;
+  case requite::Opcode::IMPORT:
+    this->logNotSupportedYet(statement);
+    return false;
+  case requite::Opcode::USE:
+    this->logNotSupportedYet(statement);
+    return false;
+  case requite::Opcode::_EXPAND_VALUE:
+    this->logNotSupportedYet(statement);
+    return false;
+  default:
+    break;
+  }
+  REQUITE_UNREACHABLE();
+}
+
 bool Context::tabulateEntryPoint(requite::Module &module,
                                  requite::Expression &expression) {
   requite::Procedure &procedure = this->makeProcedure();
@@ -13,6 +81,12 @@ bool Context::tabulateEntryPoint(requite::Module &module,
   procedure.setExpression(expression);
   expression.setProcedure(procedure);
   module.addEntryPoint(procedure);
+  return true;
+}
+
+bool Context::tabulateProcedure(requite::Module &module,
+                                requite::Procedure &procedure) {
+  requite::Expression &expression = procedure.getExpression();
   if (!expression.getHasBranch()) {
     return true;
   }
@@ -22,6 +96,30 @@ bool Context::tabulateEntryPoint(requite::Module &module,
   return true;
 }
 
+bool Context::tabulateProcedures(requite::Module &module) {
+  if (!module.getHasEntryPoint()) {
+    return true;
+  }
+  // a valid module has a single entry point and nothing else to fan out over
+  // yet, so one procedure is tabulated inline instead of as a task.
+  requite::Procedure &entry_point = module.getEntryPoint();
+  if (!entry_point.getHasNextProcedure()) {
+    return this->tabulateProcedure(module, entry_point);
+  }
+  // a procedure body only adds symbols to its own scope, so every body is
+  // tabulated by its own task once the module's symbols are registered.
+  std::atomic<bool> is_ok = true;
+  for (requite::Procedure &procedure : entry_point.getOverloadSubrange()) {
+    this->scheduleTask([this, &module, &procedure, &is_ok] {
+      if (!this->tabulateProcedure(module, procedure)) {
+        is_ok.store(false, std::memory_order_relaxed);
+      }
+    });
+  }
+  this->waitForTasks();
+  return is_ok.load(std::memory_order_relaxed);
+}
+
 bool Context::tabulateLocal(requite::Module &module, requite::Scope &scope,
                             requite::Expression &expression) {
   REQUITE_ASSERT(expression.getOpcode() == requite::Opcode::_LOCAL);
@@ -20,10 +20,16 @@ namespace requite {
 void Context::startScheduler() {
   REQUITE_ASSERT(this->_scheduler_ptr.get() == nullptr);
   llvm::ThreadPoolStrategy strategy;
-  strategy.ThreadsRequested = std::thread::hardware_concurrency();
+  const unsigned job_count = requite::getJobCount();
+  strategy.ThreadsRequested =
+      job_count == 0 ? std::thread::hardware_concurrency() : job_count;
   this->_scheduler_ptr = std::make_unique<llvm::StdThreadPool>(strategy);
 }
 
+bool Context::getHasScheduler() const {
+  return this->_scheduler_ptr.get() != nullptr;
+}
+
 void Context::waitForTasks() {
   if (this->_scheduler_ptr.get() == nullptr) {
     return;
@@ -37,15 +37,15 @@ void Tokenizer::logErrorUnmatchedRightToken(const requite::Token &token) {
     const requite::Grouping &grouping = this->getTopGrouping();
     REQUITE_ASSERT(this->getTokens().size() > grouping.token_i);
     const requite::Token &left_token = this->getTokens().at(grouping.token_i);
-    this->getContext().logSourceMessage(
-        token, requite::LogType::ERROR,
+    this->getContext().logIdentifiedSourceMessage(
+        token, requite::LogType::ERROR, "mismatched-right-grouping",
         llvm::Twine("right grouping token of type \"") +
             requite::getName(token.getType()) +
             "\" does not match previous left grouping token");
     return;
   }
-  this->getContext().logSourceMessage(
-      token, requite::LogType::ERROR,
+  this->getContext().logIdentifiedSourceMessage(
+      token, requite::LogType::ERROR, "unmatched-right-grouping",
       llvm::Twine("right grouping token of type \"") +
           requite::getName(token.getType()) +
           "\" does not follow a left grouping token");
@@ -743,9 +743,9 @@ void Tokenizer::_tokenizeTokens() {
           } else if (sub_c0 == '\0') {
             this->getTokens().push_back(this->getRanger().getSubToken(
                 requite::TokenType::ERROR_UNTERMINATED_STRING_LITERAL));
-            this->getContext().logSourceMessage(this->getTokens().back(),
-                                                requite::LogType::ERROR,
-                                                "unterminated string");
+            this->getContext().logIdentifiedSourceMessage(
+                this->getTokens().back(), requite::LogType::ERROR,
+                "unterminated-string", "unterminated string");
             this->setNotOk();
             break;
           } else {
@@ -1049,8 +1049,8 @@ void Tokenizer::checkFinalGroupings() {
     const requite::Grouping &grouping = this->getTopGrouping();
     REQUITE_ASSERT(this->getTokens().size() > grouping.token_i);
     requite::Token &token = this->getTokens().at(grouping.token_i);
-    this->getContext().logSourceMessage(
-        token, requite::LogType::ERROR,
+    this->getContext().logIdentifiedSourceMessage(
+        token, requite::LogType::ERROR, "unmatched-left-grouping",
         llvm::Twine("grouping token of type \"") +
             requite::getName(token.getType()) + "\" has no right match");
     token.setUnmatched();
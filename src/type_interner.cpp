@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include <requite/anonymous_object.hpp>
+#include <requite/assert.hpp>
+#include <requite/context.hpp>
+#include <requite/signature.hpp>
+#include <requite/tuple.hpp>
+#include <requite/type_interner.hpp>
+#include <requite/utility.hpp>
+
+#include <llvm/ADT/Hashing.h>
+
+#include <bitset>
+#include <functional>
+
+namespace requite {
+
+TypeHandle::TypeHandle(const requite::Symbol &symbol) : _symbol_ptr(&symbol) {}
+
+bool TypeHandle::operator==(const Self &rhs) const {
+  return this->_symbol_ptr == rhs._symbol_ptr;
+}
+
+bool TypeHandle::operator!=(const Self &rhs) const {
+  return this->_symbol_ptr != rhs._symbol_ptr;
+}
+
+bool TypeHandle::getIsNone() const { return this->_symbol_ptr == nullptr; }
+
+const requite::Symbol &TypeHandle::getSymbol() const {
+  return requite::getRef(this->_symbol_ptr);
+}
+
+[[nodiscard]] static std::size_t
+getHash(const requite::AttributeFlags &attributes) {
+  return std::hash<std::bitset<requite::ATTRIBUTE_TYPE_COUNT>>()(
+      attributes._flags);
+}
+
+[[nodiscard]] static std::size_t getHash(const requite::RootSymbol &root) {
+  llvm::hash_code hash =
+      llvm::hash_value(requite::getUnderlying(root.getType()));
+  if (requite::getHasDepth(root.getType())) {
+    hash = llvm::hash_combine(hash, root._depth);
+  }
+  switch (root.getType()) {
+  case requite::RootSymbolType::SIGNATURE: {
+    const requite::Signature &signature = root.getSignature();
+    for (const requite::SignatureParameter &parameter :
+         signature.getParameters()) {
+      hash = llvm::hash_combine(hash, requite::getHash(parameter.getType()));
+    }
+    return llvm::hash_combine(hash,
+                              requite::getHash(signature.getReturnType()));
+  }
+  case requite::RootSymbolType::TUPLE:
+    for (const requite::Symbol &element : root.getTuple().getElementTypes()) {
+      hash = llvm::hash_combine(hash, requite::getHash(element));
+    }
+    return hash;
+  case requite::RootSymbolType::ANONYMOUS_OBJECT:
+    for (const requite::AnonymousProperty &property :
+         root.getAnonymousObject().getProperties()) {
+      hash = llvm::hash_combine(hash, property.getName(),
+                                requite::getHash(property.getSymbol()));
+    }
+    return hash;
+  default:
+    return llvm::hash_combine(hash, root._data_ptr);
+  }
+}
+
+std::size_t getHash(const requite::Symbol &symbol) {
+  llvm::hash_code hash =
+      llvm::hash_combine(requite::getHash(symbol.getRoot()),
+                         requite::getHash(symbol.getRootAttributeFlags()));
+  for (const requite::SubSymbol &sub : symbol.getSubs()) {
+    hash = llvm::hash_combine(hash, requite::getUnderlying(sub.getType()),
+                              requite::getHash(sub.getAttributeFlags()),
+                              sub.getCount());
+  }
+  return hash;
+}
+
+const requite::Symbol *InternedSymbolInfo::getEmptyKey() {
+  return llvm::DenseMapInfo<const requite::Symbol *>::getEmptyKey();
+}
+
+const requite::Symbol *InternedSymbolInfo::getTombstoneKey() {
+  return llvm::DenseMapInfo<const requite::Symbol *>::getTombstoneKey();
+}
+
+unsigned
+InternedSymbolInfo::getHashValue(const requite::Symbol *symbol_ptr) {
+  return Self::getHashValue(requite::getRef(symbol_ptr));
+}
+
+unsigned InternedSymbolInfo::getHashValue(const requite::Symbol &symbol) {
+  const std::size_t hash = requite::getHash(symbol);
+  return static_cast<unsigned>(hash ^ (hash >> 32));
+}
+
+bool InternedSymbolInfo::isEqual(const requite::Symbol *lhs_ptr,
+                                 const requite::Symbol *rhs_ptr) {
+  // Every interned symbol is unique, so interned symbols are equal exactly
+  // when they are the same symbol.
+  return lhs_ptr == rhs_ptr;
+}
+
+bool InternedSymbolInfo::isEqual(const requite::Symbol &lhs,
+                                 const requite::Symbol *rhs_ptr) {
+  if (rhs_ptr == Self::getEmptyKey() || rhs_ptr == Self::getTombstoneKey()) {
+    return false;
+  }
+  return lhs == *rhs_ptr;
+}
+
+requite::TypeHandle TypeInterner::intern(const requite::Symbol &symbol) {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  auto it = this->_symbols.find_as(symbol);
+  if (it != this->_symbols.end()) {
+    return requite::TypeHandle(requite::getRef(*it));
+  }
+  const requite::Symbol &interned = this->_symbol_pool.make(symbol);
+  this->_symbols.insert(&interned);
+  return requite::TypeHandle(interned);
+}
+
+unsigned TypeInterner::getSize() const { return this->_symbol_pool.getSize(); }
+
+requite::TypeHandle Context::internType(const requite::Symbol &symbol) {
+  return this->_type_interner.intern(symbol);
+}
+
+} // namespace requite
@@ -26,7 +26,8 @@ bool Context::validateSourceFileText(requite::File &file) {
       llvm::SmallString<64> buffer;
       llvm::StringRef message = twine.toStringRef(buffer);
       REQUITE_ASSERT(buffer.size() <= 64);
-      this->logMessage(message);
+      this->logMessage(requite::LogType::ERROR, "invalid-utf8-codeunit",
+                       message);
       is_ok = false;
     }
     if (requite::getIsExtended(c)) {
@@ -39,9 +40,8 @@ bool Context::validateSourceFileText(requite::File &file) {
           llvm::SmallString<64> buffer;
           llvm::StringRef message = twine.toStringRef(buffer);
           REQUITE_ASSERT(buffer.size() <= 64);
-          this->logMessage(
-
-              message);
+          this->logMessage(requite::LogType::ERROR,
+                           "expected-utf8-continuation", message);
           is_ok = false;
           continue_bytes = 0;
         } else {
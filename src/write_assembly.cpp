@@ -10,8 +10,8 @@ bool Context::writeAssembly(llvm::StringRef output_path) {
   llvm::raw_fd_ostream fout(output_path, ec, llvm::sys::fs::OF_Text);
   if (ec) {
     this->logMessage(
-        llvm::Twine(
-            "error: failed to open intermediate file for writing\n\tpath: ") +
+        requite::LogType::ERROR, "open-intermediate-file-failed",
+        llvm::Twine("failed to open intermediate file for writing\n\tpath: ") +
         llvm::Twine(output_path) + llvm::Twine("\n\treason: ") +
         llvm::Twine(ec.message()));
     return false;
@@ -21,7 +21,8 @@ bool Context::writeAssembly(llvm::StringRef output_path) {
   llvm::TargetMachine &target_machine = this->getLlvmTargetMachine();
   if (target_machine.addPassesToEmitFile(pass, fout, nullptr, file_type)) {
     this->logMessage(
-        llvm::Twine("error: failed to add passes to emit file\n\tpath: ") +
+        requite::LogType::ERROR, "add-emit-passes-failed",
+        llvm::Twine("failed to add passes to emit file\n\tpath: ") +
         llvm::Twine(output_path));
     return false;
   }
@@ -6,17 +6,16 @@
 #include <requite/codeunits.hpp>
 #include <requite/context.hpp>
 #include <requite/expression.hpp>
+#include <requite/module.hpp>
 #include <requite/options.hpp>
 #include <requite/source_location.hpp>
-#include <requite/source_range.hpp>
 #include <requite/utility.hpp>
 
 #include <llvm/ADT/SmallVector.h>
 #include <llvm/Support/FileSystem.h>
-#include <llvm/Support/FormatVariadic.h>
 #include <llvm/Support/raw_ostream.h>
 
-#include <string>
+#include <system_error>
 
 namespace requite {
 
@@ -26,8 +25,7 @@ bool Context::writeAst(const requite::Module &module,
   return writer.writeAst(module, out_path);
 }
 
-AstWriter::AstWriter(requite::Context &context)
-    : _buffer(), _ostream(_buffer), _context_ref(context), _indentation(0) {}
+AstWriter::AstWriter(requite::Context &context) : _context_ref(context) {}
 
 requite::Context &AstWriter::getContext() { return _context_ref.get(); }
 
@@ -35,43 +33,89 @@ const requite::Context &AstWriter::getContext() const {
   return _context_ref.get();
 }
 
-llvm::raw_string_ostream &AstWriter::getOstream() { return _ostream; }
+llvm::raw_ostream &AstWriter::getOstream() {
+  return requite::getRef(this->_ostream_ptr);
+}
 
 bool AstWriter::writeAst(const requite::Module &module,
                          llvm::StringRef out_path) {
-  this->_buffer.clear();
-  if (module.getHasExpression()) {
-    for (const auto &expression :
-         module.getExpression().getHorizontalSubrange()) {
-      this->writeExpression(expression);
-    }
-  }
   std::error_code ec;
   llvm::raw_fd_ostream fout(out_path, ec, llvm::sys::fs::OF_Text);
   if (ec) {
     this->getContext().logMessage(
-        llvm::Twine(
-            "error: failed to open output file for writing\n\tpath: ")
-            +
+        requite::LogType::ERROR, "open-output-file-failed",
+        llvm::Twine("failed to open output file for writing\n\tpath: ") +
         llvm::Twine(out_path) + llvm::Twine("\n\treason: ") +
         llvm::Twine(ec.message()));
     return false;
   }
-  fout << this->_buffer;
+  fout.SetBufferSize(Self::OUTPUT_BUFFER_SIZE);
+  this->writeAst(module, fout);
+  fout.close();
+  if (fout.has_error()) {
+    this->getContext().logMessage(
+        requite::LogType::ERROR, "write-output-file-failed",
+        llvm::Twine("failed to write output file\n\tpath: ") +
+        llvm::Twine(out_path) + llvm::Twine("\n\treason: ") +
+        llvm::Twine(fout.error().message()));
+    fout.clear_error();
+    return false;
+  }
   return true;
 }
 
+void AstWriter::writeAst(const requite::Module &module,
+                         llvm::raw_ostream &ostream) {
+  this->_ostream_ptr = &ostream;
+  this->_indentation = 0;
+  const requite::File &file = module.getFile();
+  this->_line_table = requite::SourceLineTable(file.getIdentifier(),
+                                               file.getText());
+  if (module.getHasExpression()) {
+    this->writeExpressions(module.getExpression());
+  }
+  this->_ostream_ptr = nullptr;
+}
+
 void AstWriter::addIndentation() { this->_indentation++; }
 
 void AstWriter::removeIndentation() { this->_indentation--; }
 
 void AstWriter::writeIndentation() {
-  for (unsigned i = 0; i < this->_indentation; i++) {
-    this->getOstream() << "    ";
+  this->getOstream().indent(this->_indentation * 4);
+}
+
+void AstWriter::writeExpressions(const requite::Expression &first) {
+  // Operations are opened on the way down and closed on the way back up, with
+  // the open operations kept on an explicit stack rather than the call stack
+  // so that deeply nested asts can not overflow it.
+  llvm::SmallVector<const requite::Expression *, 32> open_stack;
+  const requite::Expression *expression_ptr = &first;
+  while (true) {
+    if (expression_ptr != nullptr) {
+      const requite::Expression &expression = *expression_ptr;
+      if (this->writeExpressionHead(expression)) {
+        open_stack.push_back(&expression);
+        this->addIndentation();
+        expression_ptr = &expression.getBranch();
+        continue;
+      }
+      expression_ptr =
+          expression.getHasNext() ? &expression.getNext() : nullptr;
+      continue;
+    }
+    if (open_stack.empty()) {
+      return;
+    }
+    const requite::Expression &operation = *open_stack.pop_back_val();
+    this->removeIndentation();
+    this->writeIndentation();
+    this->getOstream() << "]\n";
+    expression_ptr = operation.getHasNext() ? &operation.getNext() : nullptr;
   }
 }
 
-void AstWriter::writeExpression(const requite::Expression &expression) {
+bool AstWriter::writeExpressionHead(const requite::Expression &expression) {
   this->writeIndentation();
   switch (const requite::Opcode opcode = expression.getOpcode()) {
   case requite::Opcode::__INTEGER_LITERAL:
@@ -124,44 +168,39 @@ void AstWriter::writeExpression(const requite::Expression &expression) {
     if (!expression.getHasBranch()) {
       this->getOstream() << "]";
       this->writeExpressionLocationComment(expression);
-    } else {
-      this->writeExpressionLocationComment(expression);
-      {
-        requite::AstWriterIndentLock lock(*this);
-        for (const auto &branch : expression.getBranchSubrange()) {
-          this->writeExpression(branch);
-        }
-      }
-      this->writeIndentation();
-      this->getOstream() << "]\n";
+      return false;
     }
+    this->writeExpressionLocationComment(expression);
+    return true;
   }
   }
+  return false;
 }
 
 void AstWriter::writeExpressionLocationComment(
     const requite::Expression &expression) {
   this->getOstream() << "                // ";
   if (expression.getHasSourceText()) {
-    requite::SourceRange source_range =
-        this->getContext().getSourceRange(expression);
-    this->getOstream() << source_range.start.file << ":"
-                       << source_range.start.line << ":"
-                       << source_range.start.column;
-    if (source_range.start != source_range.end) {
-      this->getOstream() << "-" << source_range.end.line << ":"
-                         << source_range.end.column;
+    const char *start_ptr = expression.getSourceTextPtr();
+    const requite::SourceLocation start = this->getSourceLocation(start_ptr);
+    const requite::SourceLocation end =
+        this->getSourceLocation(start_ptr + expression.getSourceText().size());
+    this->getOstream() << start.file << ":" << start.line << ":"
+                       << start.column;
+    if (start != end) {
+      this->getOstream() << "-" << end.line << ":" << end.column;
     }
   }
   this->getOstream() << "\n";
 }
 
-AstWriterIndentLock::AstWriterIndentLock(AstWriter &writer) : _writer(writer) {
-  _writer.get().addIndentation();
-}
-
-AstWriterIndentLock::~AstWriterIndentLock() {
-  _writer.get().removeIndentation();
+requite::SourceLocation AstWriter::getSourceLocation(const char *text_ptr) {
+  if (this->_line_table.getHasLocation(text_ptr)) {
+    return this->_line_table.getLocation(text_ptr);
+  }
+  // Expressions inserted from another buffer fall back to the source manager.
+  return this->getContext().getSourceLocation(
+      llvm::SMLoc::getFromPointer(text_ptr));
 }
 
-} // namespace requite
\ No newline at end of file
+} // namespace requite
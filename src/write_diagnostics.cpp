@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include <requite/diagnostics.hpp>
+#include <requite/unreachable.hpp>
+
+#include <llvm/ADT/Twine.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace requite {
+
+// Where a diagnostic points. The line and column are only looked up when they
+// are asked for, since finding them means scanning the buffer for newlines.
+struct DiagnosticLocation final {
+  llvm::StringRef _filename = {};
+  bool _has_offset = false;
+  std::int64_t _offset = 0;
+  unsigned _line = 0;
+  unsigned _column = 0;
+};
+
+[[nodiscard]] static requite::DiagnosticLocation
+getDiagnosticLocation(const requite::Diagnostic &diagnostic,
+                      const llvm::SourceMgr &source_mgr,
+                      bool has_line_columns) {
+  requite::DiagnosticLocation location;
+  if (!diagnostic.getHasLocation()) {
+    location._filename = diagnostic.getFilename();
+    return location;
+  }
+  const unsigned buffer_id =
+      source_mgr.FindBufferContainingLoc(diagnostic.getLocation());
+  if (buffer_id == 0) {
+    return location;
+  }
+  const llvm::MemoryBuffer &buffer = *source_mgr.getMemoryBuffer(buffer_id);
+  location._filename = buffer.getBufferIdentifier();
+  location._has_offset = true;
+  location._offset = static_cast<std::int64_t>(
+      diagnostic.getLocation().getPointer() - buffer.getBufferStart());
+  if (has_line_columns) {
+    std::tie(location._line, location._column) =
+        source_mgr.getLineAndColumn(diagnostic.getLocation(), buffer_id);
+  }
+  return location;
+}
+
+[[nodiscard]] static llvm::StringRef getJsonLevel(requite::LogType type) {
+  switch (type) {
+  case requite::LogType::ERROR:
+    return "error";
+  case requite::LogType::WARN:
+    return "warning";
+  case requite::LogType::REMARK:
+    return "remark";
+  case requite::LogType::NOTE:
+    return "note";
+  }
+  REQUITE_UNREACHABLE();
+}
+
+[[nodiscard]] static llvm::StringRef getSarifLevel(requite::LogType type) {
+  switch (type) {
+  case requite::LogType::ERROR:
+    return "error";
+  case requite::LogType::WARN:
+    return "warning";
+  case requite::LogType::REMARK:
+  case requite::LogType::NOTE:
+    return "note";
+  }
+  REQUITE_UNREACHABLE();
+}
+
+[[nodiscard]] static llvm::StringRef getOpcodeName(requite::Opcode opcode) {
+  const std::string_view name = requite::getName(opcode);
+  return llvm::StringRef(name.data(), name.size());
+}
+
+[[nodiscard]] static requite::Diagnostic
+makeErrorLimitDiagnostic(unsigned error_limit) {
+  requite::Diagnostic diagnostic;
+  diagnostic._type = requite::LogType::ERROR;
+  diagnostic._id = "error-limit";
+  diagnostic._message =
+      (llvm::Twine("stopped after ") + llvm::Twine(error_limit) + " errors")
+          .str();
+  return diagnostic;
+}
+
+void Diagnostics::writeJson(const llvm::SourceMgr &source_mgr,
+                            llvm::raw_ostream &ostream,
+                            bool has_line_columns) {
+  // One object per line, so that a consumer can stream the records without
+  // parsing the whole output.
+  std::vector<requite::Diagnostic> diagnostics;
+  this->gather(diagnostics, source_mgr);
+  if (this->getHasDroppedErrors()) {
+    diagnostics.push_back(
+        requite::makeErrorLimitDiagnostic(this->getErrorLimit()));
+  }
+  for (const requite::Diagnostic &diagnostic : diagnostics) {
+    const requite::DiagnosticLocation location = requite::getDiagnosticLocation(
+        diagnostic, source_mgr, has_line_columns);
+    llvm::json::OStream json(ostream);
+    json.object([&] {
+      json.attribute("level", requite::getJsonLevel(diagnostic.getType()));
+      if (!location._filename.empty()) {
+        json.attribute("file", location._filename);
+      }
+      if (location._has_offset) {
+        json.attribute("offset", location._offset);
+        if (has_line_columns) {
+          json.attribute("line", location._line);
+          json.attribute("column", location._column);
+        }
+      }
+      if (diagnostic.getHasOpcode()) {
+        json.attribute("opcode",
+                       requite::getOpcodeName(diagnostic.getOpcode()));
+      }
+      if (diagnostic.getHasId()) {
+        json.attribute("id", diagnostic.getId());
+      }
+      json.attribute("message", diagnostic.getMessage());
+    });
+    ostream << '\n';
+  }
+  ostream.flush();
+}
+
+void Diagnostics::writeSarif(const llvm::SourceMgr &source_mgr,
+                             llvm::raw_ostream &ostream,
+                             bool has_line_columns) {
+  std::vector<requite::Diagnostic> diagnostics;
+  this->gather(diagnostics, source_mgr);
+  if (this->getHasDroppedErrors()) {
+    diagnostics.push_back(
+        requite::makeErrorLimitDiagnostic(this->getErrorLimit()));
+  }
+  llvm::json::OStream json(ostream);
+  json.object([&] {
+    json.attribute("version", "2.1.0");
+    json.attribute("$schema", "https://json.schemastore.org/sarif-2.1.0.json");
+    json.attributeArray("runs", [&] {
+      json.object([&] {
+        json.attributeObject("tool", [&] {
+          json.attributeObject("driver",
+                               [&] { json.attribute("name", "requite"); });
+        });
+        json.attributeArray("results", [&] {
+          for (const requite::Diagnostic &diagnostic : diagnostics) {
+            const requite::DiagnosticLocation location =
+                requite::getDiagnosticLocation(diagnostic, source_mgr,
+                                               has_line_columns);
+            json.object([&] {
+              if (diagnostic.getHasId()) {
+                json.attribute("ruleId", diagnostic.getId());
+              }
+              json.attribute("level",
+                             requite::getSarifLevel(diagnostic.getType()));
+              json.attributeObject("message", [&] {
+                json.attribute("text", diagnostic.getMessage());
+              });
+              if (!location._filename.empty()) {
+                json.attributeArray("locations", [&] {
+                  json.object([&] {
+                    json.attributeObject("physicalLocation", [&] {
+                      json.attributeObject("artifactLocation", [&] {
+                        json.attribute("uri", location._filename);
+                      });
+                      if (location._has_offset) {
+                        json.attributeObject("region", [&] {
+                          json.attribute("byteOffset", location._offset);
+                          if (has_line_columns) {
+                            json.attribute("startLine", location._line);
+                            json.attribute("startColumn", location._column);
+                          }
+                        });
+                      }
+                    });
+                  });
+                });
+              }
+              if (diagnostic.getHasOpcode()) {
+                json.attributeObject("properties", [&] {
+                  json.attribute(
+                      "opcode", requite::getOpcodeName(diagnostic.getOpcode()));
+                });
+              }
+            });
+          }
+        });
+      });
+    });
+  });
+  ostream << '\n';
+  ostream.flush();
+}
+
+} // namespace requite
@@ -14,8 +14,8 @@ bool Context::writeLlvmIr(llvm::StringRef output_path) {
   llvm::raw_fd_ostream fout(output_path, ec, llvm::sys::fs::OF_Text);
   if (ec) {
     this->logMessage(
-        llvm::Twine(
-            "error: failed to open intermediate file for writing\n\tpath: ") +
+        requite::LogType::ERROR, "open-intermediate-file-failed",
+        llvm::Twine("failed to open intermediate file for writing\n\tpath: ") +
         llvm::Twine(output_path) + llvm::Twine("\n\treason: ") +
         llvm::Twine(ec.message()));
     return false;
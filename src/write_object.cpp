@@ -1,5 +1,9 @@
 #include <requite/context.hpp>
+#include <requite/object_cache.hpp>
+#include <requite/options.hpp>
 
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/SmallVector.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/Support/FileSystem.h>
 
@@ -10,24 +14,86 @@ bool Context::writeObject(llvm::StringRef output_path) {
   llvm::raw_fd_ostream fout(output_path, ec, llvm::sys::fs::OF_Text);
   if (ec) {
     this->logMessage(
-        llvm::Twine(
-            "error: failed to open intermediate file for writing\n\tpath: ") +
+        requite::LogType::ERROR, "open-intermediate-file-failed",
+        llvm::Twine("failed to open intermediate file for writing\n\tpath: ") +
         llvm::Twine(output_path) + llvm::Twine("\n\treason: ") +
         llvm::Twine(ec.message()));
     return false;
   }
+  requite::ObjectCache &cache = this->getObjectCache();
+  if (!cache.getIsEnabled()) {
+    return this->emitObject(fout, output_path);
+  }
+  llvm::SmallString<64> key;
+  requite::ObjectCache::getKey(key, this->getLlvmModule(),
+                               this->getLlvmTargetMachine());
+  if (std::unique_ptr<llvm::MemoryBuffer> cached = cache.lookup(key)) {
+    fout << cached->getBuffer();
+    fout.flush();
+    this->logObjectCacheStats();
+    return true;
+  }
+  llvm::SmallVector<char, 0> object;
+  llvm::raw_svector_ostream object_ostream(object);
+  if (!this->emitObject(object_ostream, output_path)) {
+    return false;
+  }
+  fout << object_ostream.str();
+  fout.flush();
+  ec = cache.insert(key, object_ostream.str());
+  if (ec) {
+    this->logMessage(
+        requite::LogType::WARN, "object-cache-add-failed",
+        llvm::Twine("failed to add object file to cache\n\tpath: ") +
+        llvm::Twine(cache.getDirectory()) + llvm::Twine("\n\treason: ") +
+        llvm::Twine(ec.message()));
+  }
+  this->logObjectCacheStats();
+  return true;
+}
+
+bool Context::emitObject(llvm::raw_pwrite_stream &ostream,
+                         llvm::StringRef output_path) {
   llvm::legacy::PassManager pass;
   const auto file_type = llvm::CodeGenFileType::ObjectFile;
   llvm::TargetMachine &target_machine = this->getLlvmTargetMachine();
-  if (target_machine.addPassesToEmitFile(pass, fout, nullptr, file_type)) {
+  if (target_machine.addPassesToEmitFile(pass, ostream, nullptr, file_type)) {
     this->logMessage(
-        llvm::Twine("error: failed to add passes to emit file\n\tpath: ") +
+        requite::LogType::ERROR, "add-emit-passes-failed",
+        llvm::Twine("failed to add passes to emit file\n\tpath: ") +
         llvm::Twine(output_path));
     return false;
   }
   pass.run(this->getLlvmModule());
-  fout.flush();
+  ostream.flush();
   return true;
 }
 
-} // namespace requite
\ No newline at end of file
+void Context::initializeObjectCache() {
+  llvm::StringRef directory = requite::getObjectCacheDirectory();
+  if (directory.empty() || this->getObjectCache().getIsEnabled()) {
+    return;
+  }
+  this->getObjectCache().enable(
+      directory, requite::getObjectCacheSizeLimitInMegabytes() * 1024 * 1024);
+}
+
+requite::ObjectCache &Context::getObjectCache() { return this->_object_cache; }
+
+const requite::ObjectCache &Context::getObjectCache() const {
+  return this->_object_cache;
+}
+
+void Context::logObjectCacheStats() {
+  if (!requite::getIsObjectCacheStatsShown()) {
+    return;
+  }
+  const requite::ObjectCache &cache = this->getObjectCache();
+  this->logMessage(requite::LogType::NOTE, "object-cache-stats",
+                   llvm::Twine("object cache hits: ") +
+                       llvm::Twine(cache.getHitCount()) +
+                       llvm::Twine(", misses: ") +
+                       llvm::Twine(cache.getMissCount()));
+}
+
+} // namespace requite
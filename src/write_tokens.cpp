@@ -2,49 +2,117 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <requite/binary_tokens.hpp>
 #include <requite/context.hpp>
 #include <requite/csv.hpp>
+#include <requite/module.hpp>
 #include <requite/token.hpp>
+#include <requite/utility.hpp>
 
-#include "llvm/Support/FormatVariadic.h"
-#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/STLExtras.h>
 #include <llvm/ADT/StringRef.h>
 #include <llvm/ADT/Twine.h>
 #include <llvm/Support/FileSystem.h>
-#include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/raw_ostream.h>
 
-#include <memory>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <system_error>
 
 namespace requite {
 
-bool Context::writeTokens(requite::Module &module,
-                            std::vector<requite::Token> &tokens, llvm::StringRef out_path) {
-  llvm::SmallString<64> str_buffer_a;
-  llvm::SmallString<64> str_buffer_b;
-  llvm::raw_svector_ostream str_buffer_a_ostream(str_buffer_a);
-  for (const requite::Token &token : tokens) {
-    str_buffer_b.clear();
-    llvm::StringRef text = token.getSourceText();
-    llvm::StringRef csv_value_text =
-        requite::getCsvValueText(str_buffer_b, text);
-    str_buffer_a_ostream << llvm::formatv(
-        "{0},{1},{2},{3},{4}\n", token.getLine(), token.getColumn(),
-        token.getSourceTextLength(), requite::getName(token.getType()),
-        csv_value_text);
-  }
+static constexpr std::size_t TOKEN_OUTPUT_BUFFER_SIZE = 256 * 1024;
+
+[[nodiscard]] static bool
+writeTokenFile(requite::Context &context, llvm::StringRef out_path,
+               llvm::sys::fs::OpenFlags flags,
+               llvm::function_ref<void(llvm::raw_ostream &)> write) {
   std::error_code ec;
-  llvm::raw_fd_ostream fout(out_path, ec, llvm::sys::fs::OF_Text);
+  llvm::raw_fd_ostream fout(out_path, ec, flags);
   if (ec) {
-    this->logMessage(
-        llvm::Twine(
-            "error: failed to open output file for writing\n\tPath: ") +
+    context.logMessage(
+        requite::LogType::ERROR, "open-output-file-failed",
+        llvm::Twine("failed to open output file for writing\n\tPath: ") +
         llvm::Twine(out_path) + llvm::Twine("\n\tReason: ") +
         llvm::Twine(ec.message()));
     return false;
   }
-  fout << str_buffer_a_ostream.str();
+  fout.SetBufferSize(requite::TOKEN_OUTPUT_BUFFER_SIZE);
+  write(fout);
+  fout.close();
+  if (fout.has_error()) {
+    context.logMessage(
+        requite::LogType::ERROR, "write-output-file-failed",
+        llvm::Twine("failed to write output file\n\tPath: ") +
+        llvm::Twine(out_path) + llvm::Twine("\n\tReason: ") +
+        llvm::Twine(fout.error().message()));
+    fout.clear_error();
+    return false;
+  }
   return true;
 }
 
-} // namespace requite
\ No newline at end of file
+static void writeTokenUnsigned(llvm::raw_ostream &ostream, unsigned value) {
+  char digits[10];
+  char *digit_ptr = std::end(digits);
+  do {
+    *--digit_ptr = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  ostream.write(digit_ptr, std::end(digits) - digit_ptr);
+}
+
+bool Context::writeTokens(requite::Module &module,
+                          std::vector<requite::Token> &tokens,
+                          llvm::StringRef out_path) {
+  return requite::writeTokenFile(
+      *this, out_path, llvm::sys::fs::OF_Text,
+      [&tokens](llvm::raw_ostream &ostream) {
+        for (const requite::Token &token : tokens) {
+          requite::writeTokenUnsigned(ostream, token.getLine());
+          ostream << ',';
+          requite::writeTokenUnsigned(ostream, token.getColumn());
+          ostream << ',';
+          requite::writeTokenUnsigned(ostream, token.getSourceTextLength());
+          ostream << ',';
+          const std::string_view name = requite::getName(token.getType());
+          ostream.write(name.data(), name.size());
+          ostream << ',';
+          requite::writeCsvValueText(ostream, token.getSourceText());
+          ostream << '\n';
+        }
+      });
+}
+
+bool Context::writeBinaryTokens(requite::Module &module,
+                                std::vector<requite::Token> &tokens,
+                                llvm::StringRef out_path) {
+  const char *text_ptr = module.getTextPtr();
+  return requite::writeTokenFile(
+      *this, out_path, llvm::sys::fs::OF_None,
+      [&tokens, text_ptr](llvm::raw_ostream &ostream) {
+        requite::BinaryTokensHeader header = {};
+        header._magic = requite::BINARY_TOKENS_MAGIC;
+        header._version = requite::BINARY_TOKENS_VERSION;
+        header._byte_order = requite::BINARY_TOKENS_BYTE_ORDER;
+        header._token_count = tokens.size();
+        ostream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        for (const requite::Token &token : tokens) {
+          requite::BinaryToken record = {};
+          record._line = token.getLine();
+          record._column = token.getColumn();
+          record._source_offset =
+              static_cast<std::uint32_t>(token.getSourceTextPtr() - text_ptr);
+          record._source_length = token.getSourceTextLength();
+          record._type = static_cast<std::uint16_t>(
+              requite::getUnderlying(token.getType()));
+          record._spacing = static_cast<std::uint8_t>(
+              requite::getUnderlying(token.getSpacing()));
+          ostream.write(reinterpret_cast<const char *>(&record),
+                        sizeof(record));
+        }
+      });
+}
+
+} // namespace requite
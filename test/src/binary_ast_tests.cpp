@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/binary_ast.hpp>
+#include <requite/context.hpp>
+#include <requite/expression.hpp>
+#include <requite/module.hpp>
+
+#include <llvm/ADT/APSInt.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <memory>
+#include <string>
+
+static std::unique_ptr<llvm::MemoryBuffer>
+writeToBuffer(const requite::Expression *first, llvm::StringRef source_text) {
+  std::string data;
+  llvm::raw_string_ostream ostream(data);
+  requite::writeBinaryAst(first, "test.rq", source_text, ostream);
+  ostream.flush();
+  return llvm::MemoryBuffer::getMemBufferCopy(data, "test.rqast");
+}
+
+TEST_CASE("requite::BinaryAst") {
+  static constexpr llvm::StringRef SOURCE_TEXT = "(+ a 18446744073709551617)";
+
+  SECTION("round trip") {
+    requite::Expression &add =
+        requite::Expression::makeOperation(requite::Opcode::_ADD);
+    add._source_text_ptr = SOURCE_TEXT.data();
+    add._source_text_length = SOURCE_TEXT.size();
+    requite::Expression &identifier =
+        requite::Expression::makeIdentifier("a");
+    identifier._source_text_ptr = SOURCE_TEXT.data() + 3;
+    identifier._source_text_length = 1;
+    const llvm::APSInt integer_value(
+        llvm::APInt(65, "18446744073709551617", 10), true);
+    requite::Expression &integer = requite::Expression::makeInteger();
+    integer.emplaceInteger() = integer_value;
+    add.setBranch(identifier);
+    identifier.setNext(integer);
+    std::unique_ptr<llvm::MemoryBuffer> buffer_uptr =
+        writeToBuffer(&add, SOURCE_TEXT);
+    requite::Expression::deleteExpression(add);
+
+    requite::BinaryAst binary_ast;
+    REQUIRE(binary_ast.read(buffer_uptr->getBuffer()));
+    CHECK(binary_ast.getIdentifier() == "test.rq");
+    CHECK(binary_ast.getSourceText() == SOURCE_TEXT);
+    REQUIRE(binary_ast.getHasExpression());
+    const requite::Expression &read_add = binary_ast.getExpression();
+    CHECK(read_add.getOpcode() == requite::Opcode::_ADD);
+    CHECK(read_add.getSourceText() == SOURCE_TEXT);
+    CHECK_FALSE(read_add.getHasNext());
+    REQUIRE(read_add.getHasBranch());
+    const requite::Expression &read_identifier = read_add.getBranch();
+    CHECK(read_identifier.getIsIdentifier());
+    CHECK(read_identifier.getDataText() == "a");
+    CHECK(read_identifier.getSourceText() == "a");
+    REQUIRE(read_identifier.getHasNext());
+    const requite::Expression &read_integer = read_identifier.getNext();
+    CHECK(read_integer.getIsInteger());
+    CHECK_FALSE(read_integer.getHasSourceText());
+    REQUIRE(read_integer.getHasInteger());
+    CHECK(read_integer.getInteger().getBitWidth() == 65);
+    CHECK(read_integer.getInteger().isUnsigned());
+    CHECK(read_integer.getInteger() == integer_value);
+    CHECK_FALSE(read_integer.getHasNext());
+  }
+
+  SECTION("empty") {
+    std::unique_ptr<llvm::MemoryBuffer> buffer_uptr =
+        writeToBuffer(nullptr, "");
+    requite::BinaryAst binary_ast;
+    REQUIRE(binary_ast.read(buffer_uptr->getBuffer()));
+    CHECK_FALSE(binary_ast.getHasExpression());
+  }
+
+  SECTION("invalid") {
+    requite::Expression &identifier =
+        requite::Expression::makeIdentifier("a");
+    std::unique_ptr<llvm::MemoryBuffer> buffer_uptr =
+        writeToBuffer(&identifier, SOURCE_TEXT);
+    requite::Expression::deleteExpression(identifier);
+    requite::BinaryAst binary_ast;
+    CHECK_FALSE(binary_ast.read(buffer_uptr->getBuffer().drop_back(8)));
+    std::string corrupt_data = buffer_uptr->getBuffer().str();
+    corrupt_data[0] = 'X';
+    std::unique_ptr<llvm::MemoryBuffer> corrupt_uptr =
+        llvm::MemoryBuffer::getMemBufferCopy(corrupt_data, "test.rqast");
+    CHECK_FALSE(binary_ast.read(corrupt_uptr->getBuffer()));
+  }
+
+  SECTION("read into a module") {
+    requite::Expression &add =
+        requite::Expression::makeOperation(requite::Opcode::_ADD);
+    requite::Expression &identifier =
+        requite::Expression::makeIdentifier("a");
+    requite::Expression &integer = requite::Expression::makeInteger();
+    integer.emplaceInteger() = llvm::APSInt(llvm::APInt(64, 1), true);
+    add.setBranch(identifier);
+    identifier.setNext(integer);
+    int fd = -1;
+    llvm::SmallString<128> path;
+    REQUIRE_FALSE(
+        llvm::sys::fs::createTemporaryFile("requite", "rqast", fd, path));
+    {
+      llvm::raw_fd_ostream ostream(fd, true);
+      requite::writeBinaryAst(&add, "test.rq", SOURCE_TEXT, ostream);
+    }
+    requite::Expression::deleteExpression(add);
+
+    requite::Context context(std::string("requite"));
+    requite::Module module;
+    REQUIRE(context.readBinaryAst(module, path));
+    llvm::sys::fs::remove(path);
+    CHECK(module.getText() == SOURCE_TEXT);
+    REQUIRE(module.getHasExpression());
+    requite::Expression &read_add = module.getExpression();
+    CHECK(read_add.getOpcode() == requite::Opcode::_ADD);
+    REQUIRE(read_add.getHasBranch());
+    requite::Expression &read_identifier = read_add.getBranch();
+    CHECK(read_identifier.getDataText() == "a");
+    // the expressions are read in place rather than copied, and passes can
+    // still splice and delete them one at a time.
+    CHECK(read_add._is_in_array);
+    CHECK(read_identifier._is_in_array);
+    requite::Expression::deleteExpression(read_identifier.popNext());
+    CHECK_FALSE(read_identifier.getHasNext());
+    read_identifier.setNext(requite::Expression::makeIdentifier("b"));
+    CHECK_FALSE(read_identifier.getNext()._is_in_array);
+    requite::Expression::deleteExpression(module.popExpression());
+  }
+}
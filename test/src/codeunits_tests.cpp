@@ -2794,4 +2794,21 @@ TEST_CASE("requite::getIsValid(char)") {
       CHECK_FALSE(requite::getIsValid(codeunit));
     }
   }
-}
\ No newline at end of file
+}
+TEST_CASE("requite::getUtf32FromName(llvm::StringRef)") {
+  SECTION("common names") {
+    CHECK(requite::getUtf32FromName("SPACE") == 0x20);
+    CHECK(requite::getUtf32FromName("LATIN CAPITAL LETTER A") == 0x41);
+    CHECK(requite::getUtf32FromName("TILDE") == 0x7E);
+    CHECK(requite::getUtf32FromName("EURO SIGN") == 0x20AC);
+    CHECK(requite::getUtf32FromName("GRINNING FACE") == 0x1F600);
+  }
+  SECTION("uncommon names") {
+    CHECK(requite::getUtf32FromName("LATIN SMALL LETTER SHARP S") == 0xDF);
+    CHECK(requite::getUtf32FromName("SNOWMAN") == 0x2603);
+  }
+  SECTION("invalid names") {
+    CHECK_FALSE(requite::getUtf32FromName("").has_value());
+    CHECK_FALSE(requite::getUtf32FromName("NOT A CHARACTER NAME").has_value());
+  }
+}
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/context.hpp>
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("requite::Context::getThreadSymbolPools") {
+  requite::Context context(std::string("requite"));
+
+  SECTION("same pools on one thread") {
+    requite::SymbolPools &pools = context.getThreadSymbolPools();
+    CHECK(&context.getThreadSymbolPools() == &pools);
+    requite::Context other_context(std::string("requite"));
+    CHECK(&other_context.getThreadSymbolPools() != &pools);
+  }
+
+  SECTION("symbols made from many threads") {
+    static constexpr unsigned THREAD_COUNT = 4;
+    static constexpr unsigned VARIABLE_COUNT = 200;
+    std::vector<std::vector<requite::OrderedVariable *>> variable_ptrs(
+        THREAD_COUNT);
+    std::vector<requite::SymbolPools *> pools_ptrs(THREAD_COUNT);
+    std::vector<std::thread> threads;
+    for (unsigned thread_i = 0; thread_i < THREAD_COUNT; ++thread_i) {
+      threads.emplace_back([&context, &variable_ptrs, &pools_ptrs, thread_i] {
+        pools_ptrs[thread_i] = &context.getThreadSymbolPools();
+        for (unsigned variable_i = 0; variable_i < VARIABLE_COUNT;
+             ++variable_i) {
+          variable_ptrs[thread_i].push_back(&context.makeOrderedVariable());
+        }
+      });
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+    std::set<requite::SymbolPools *> unique_pools_ptrs(pools_ptrs.begin(),
+                                                       pools_ptrs.end());
+    CHECK(unique_pools_ptrs.size() == THREAD_COUNT);
+    std::set<requite::OrderedVariable *> unique_variable_ptrs;
+    for (unsigned thread_i = 0; thread_i < THREAD_COUNT; ++thread_i) {
+      CHECK(pools_ptrs[thread_i]->_ordered_variable_pool.getSize() ==
+            VARIABLE_COUNT);
+      unique_variable_ptrs.insert(variable_ptrs[thread_i].begin(),
+                                  variable_ptrs[thread_i].end());
+    }
+    CHECK(unique_variable_ptrs.size() == THREAD_COUNT * VARIABLE_COUNT);
+  }
+}
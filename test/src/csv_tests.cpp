@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/csv.hpp>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <string>
+
+static std::string getCsvValue(llvm::StringRef text) {
+  llvm::SmallString<64> buffer;
+  llvm::raw_svector_ostream ostream(buffer);
+  requite::writeCsvValueText(ostream, text);
+  return buffer.str().str();
+}
+
+TEST_CASE("requite::writeCsvValueText") {
+  CHECK(getCsvValue("") == "\"  \"");
+  CHECK(getCsvValue("abc") == "\" abc \"");
+  CHECK(getCsvValue("a\"b") == "\" a\"\"b \"");
+  CHECK(getCsvValue("\t\r\\") == "\" \\t\\r\\\\ \"");
+  CHECK(getCsvValue("a long identifier\twith a tab") ==
+        "\" a long identifier\\twith a tab \"");
+}
+
+TEST_CASE("requite::getHasCsvEscapes") {
+  CHECK_FALSE(requite::getHasCsvEscapes(""));
+  CHECK_FALSE(requite::getHasCsvEscapes("abcdefghijklmnopq"));
+  CHECK_FALSE(requite::getHasCsvEscapes("\x01\x1f\x7f\xff abcdefgh"));
+  std::string text(33, 'x');
+  for (std::size_t char_i = 0; char_i < text.size(); ++char_i) {
+    for (const char c : {'\"', '\t', '\v', '\n', '\r', '\\'}) {
+      text[char_i] = c;
+      CHECK(requite::getHasCsvEscapes(text));
+    }
+    text[char_i] = 'x';
+  }
+}
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/diagnostics.hpp>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+static requite::Diagnostic makeDiagnostic(requite::LogType type,
+                                          const char *location,
+                                          llvm::StringRef message) {
+  requite::Diagnostic diagnostic;
+  diagnostic._type = type;
+  diagnostic._location = llvm::SMLoc::getFromPointer(location);
+  diagnostic._message = message.str();
+  return diagnostic;
+}
+
+TEST_CASE("requite::Diagnostics") {
+  llvm::SourceMgr source_mgr;
+  source_mgr.AddNewSourceBuffer(
+      llvm::MemoryBuffer::getMemBuffer("a b c\nd e f\n", "test.rq"),
+      llvm::SMLoc());
+  const char *text = source_mgr.getMemoryBuffer(1)->getBufferStart();
+
+  SECTION("sorted by source position") {
+    requite::Diagnostics diagnostics;
+    diagnostics.report(
+        makeDiagnostic(requite::LogType::ERROR, text + 8, "third"));
+    diagnostics.report(
+        makeDiagnostic(requite::LogType::ERROR, text + 0, "first"));
+    diagnostics.report(
+        makeDiagnostic(requite::LogType::NOTE, text + 0, "second"));
+    std::vector<requite::Diagnostic> gathered;
+    diagnostics.gather(gathered, source_mgr);
+    REQUIRE(gathered.size() == 3);
+    CHECK(gathered[0].getMessage() == "first");
+    CHECK(gathered[1].getMessage() == "second");
+    CHECK(gathered[2].getMessage() == "third");
+  }
+
+  SECTION("reported from many threads") {
+    requite::Diagnostics diagnostics;
+    std::vector<std::thread> threads;
+    for (unsigned thread_i = 0; thread_i < 4; ++thread_i) {
+      threads.emplace_back([&diagnostics, text, thread_i] {
+        diagnostics.report(makeDiagnostic(requite::LogType::ERROR,
+                                          text + 6 - thread_i * 2,
+                                          std::to_string(thread_i)));
+      });
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+    std::vector<requite::Diagnostic> gathered;
+    diagnostics.gather(gathered, source_mgr);
+    REQUIRE(gathered.size() == 4);
+    CHECK(gathered[0].getMessage() == "3");
+    CHECK(gathered[1].getMessage() == "2");
+    CHECK(gathered[2].getMessage() == "1");
+    CHECK(gathered[3].getMessage() == "0");
+  }
+
+  SECTION("ties broken by text") {
+    requite::Diagnostics diagnostics;
+    std::thread thread([&diagnostics, text] {
+      diagnostics.report(
+          makeDiagnostic(requite::LogType::ERROR, text + 2, "b"));
+    });
+    thread.join();
+    diagnostics.report(makeDiagnostic(requite::LogType::ERROR, text + 2, "c"));
+    diagnostics.report(makeDiagnostic(requite::LogType::ERROR, text + 2, "a"));
+    std::vector<requite::Diagnostic> gathered;
+    diagnostics.gather(gathered, source_mgr);
+    REQUIRE(gathered.size() == 3);
+    CHECK(gathered[0].getMessage() == "a");
+    CHECK(gathered[1].getMessage() == "b");
+    CHECK(gathered[2].getMessage() == "c");
+  }
+
+  SECTION("error limit") {
+    requite::Diagnostics diagnostics;
+    diagnostics.setErrorLimit(2);
+    diagnostics.report(
+        makeDiagnostic(requite::LogType::ERROR, text + 8, "three"));
+    CHECK_FALSE(diagnostics.getIsErrorLimitReached());
+    diagnostics.report(makeDiagnostic(requite::LogType::ERROR, text + 4, "two"));
+    CHECK(diagnostics.getIsErrorLimitReached());
+    diagnostics.report(makeDiagnostic(requite::LogType::NOTE, text + 8, "here"));
+    diagnostics.report(makeDiagnostic(requite::LogType::ERROR, text, "one"));
+    CHECK(diagnostics.getErrorCount() == 3);
+    llvm::SmallString<256> buffer;
+    llvm::raw_svector_ostream ostream(buffer);
+    diagnostics.render(source_mgr, ostream);
+    CHECK(buffer.str().contains("one"));
+    CHECK(buffer.str().contains("two"));
+    CHECK_FALSE(buffer.str().contains("three"));
+    CHECK_FALSE(buffer.str().contains("here"));
+    CHECK(buffer.str().contains("stopped after 2 errors"));
+  }
+
+  SECTION("plain messages keep their kind") {
+    requite::Diagnostics diagnostics;
+    diagnostics.report(makeDiagnostic(requite::LogType::WARN, nullptr, "hmm"));
+    llvm::SmallString<256> buffer;
+    llvm::raw_svector_ostream ostream(buffer);
+    diagnostics.render(source_mgr, ostream);
+    CHECK(buffer.str() == "warning: hmm\n");
+  }
+
+  SECTION("json") {
+    requite::Diagnostics diagnostics;
+    diagnostics.report(
+        makeDiagnostic(requite::LogType::ERROR, text + 8, "bad \"e\""));
+    llvm::SmallString<256> buffer;
+    llvm::raw_svector_ostream ostream(buffer);
+    diagnostics.writeJson(source_mgr, ostream, false);
+    CHECK(buffer.str() == "{\"level\":\"error\",\"file\":\"test.rq\","
+                          "\"offset\":8,\"message\":\"bad \\\"e\\\"\"}\n");
+    diagnostics.report(
+        makeDiagnostic(requite::LogType::NOTE, text + 8, "here"));
+    buffer.clear();
+    diagnostics.writeJson(source_mgr, ostream, true);
+    CHECK(buffer.str() == "{\"level\":\"note\",\"file\":\"test.rq\","
+                          "\"offset\":8,\"line\":2,\"column\":3,"
+                          "\"message\":\"here\"}\n");
+  }
+
+  SECTION("sarif") {
+    requite::Diagnostics diagnostics;
+    requite::Diagnostic diagnostic =
+        makeDiagnostic(requite::LogType::WARN, text + 2, "careful");
+    diagnostic._id = "test-id";
+    diagnostics.report(std::move(diagnostic));
+    llvm::SmallString<512> buffer;
+    llvm::raw_svector_ostream ostream(buffer);
+    diagnostics.writeSarif(source_mgr, ostream, false);
+    CHECK(buffer.str().contains("\"version\":\"2.1.0\""));
+    CHECK(buffer.str().contains("\"ruleId\":\"test-id\""));
+    CHECK(buffer.str().contains("\"level\":\"warning\""));
+    CHECK(buffer.str().contains("\"byteOffset\":2"));
+    CHECK_FALSE(buffer.str().contains("startLine"));
+  }
+}
@@ -0,0 +1,233 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/context.hpp>
+#include <requite/expression.hpp>
+#include <requite/opcode.hpp>
+#include <requite/scope.hpp>
+#include <requite/symbol.hpp>
+
+#include <llvm/ADT/APInt.h>
+#include <llvm/ADT/APSInt.h>
+
+#include <cstdint>
+#include <string>
+
+static requite::Expression &makeLiteral(requite::Context &context,
+                                        std::int64_t value, unsigned depth,
+                                        bool is_unsigned = false) {
+  requite::Symbol type;
+  type.getRoot().setType(is_unsigned
+                             ? requite::RootSymbolType::UNSIGNED_INTEGER
+                             : requite::RootSymbolType::SIGNED_INTEGER);
+  type.getRoot().setDepth(depth);
+  requite::Expression &literal = requite::Expression::makeInteger();
+  literal.emplaceInteger() = llvm::APSInt(llvm::APInt(64, value, true), false);
+  literal.setResolvedType(context.internType(type));
+  return literal;
+}
+
+static requite::Expression &makeBinary(requite::Opcode opcode,
+                                       requite::Expression &lhs,
+                                       requite::Expression &rhs) {
+  requite::Expression &operation =
+      requite::Expression::makeOperation(opcode);
+  operation.setBranch(lhs);
+  lhs.setNext(rhs);
+  return operation;
+}
+
+static bool evaluate(requite::Context &context, requite::Expression &expression,
+                     llvm::APSInt &out_value) {
+  requite::Scope scope;
+  const bool is_ok =
+      context.evaluateConstantInteger(out_value, scope, expression);
+  requite::Expression::deleteExpression(expression);
+  return is_ok;
+}
+
+TEST_CASE("requite::Context::evaluateConstantInteger") {
+  requite::Context context(std::string("requite"));
+  llvm::APSInt value;
+
+  SECTION("arithmetic") {
+    REQUIRE(evaluate(context,
+                     makeBinary(requite::Opcode::_ADD, makeLiteral(context, 2, 32),
+                                makeLiteral(context, 3, 32)),
+                     value));
+    CHECK(value == 5);
+    CHECK(value.getBitWidth() == 32);
+    REQUIRE(evaluate(context,
+                     makeBinary(requite::Opcode::_SUBTRACT,
+                                makeLiteral(context, 2, 32),
+                                makeLiteral(context, 5, 32)),
+                     value));
+    CHECK(value == -3);
+    REQUIRE(evaluate(context,
+                     makeBinary(requite::Opcode::_DIVIDE,
+                                makeLiteral(context, 7, 32),
+                                makeLiteral(context, 2, 32)),
+                     value));
+    CHECK(value == 3);
+    REQUIRE(evaluate(context,
+                     makeBinary(requite::Opcode::_MODULUS,
+                                makeLiteral(context, 7, 32),
+                                makeLiteral(context, 3, 32)),
+                     value));
+    CHECK(value == 1);
+    REQUIRE(evaluate(context,
+                     makeBinary(requite::Opcode::_ADD,
+                                makeLiteral(context, 255, 8, true),
+                                makeLiteral(context, 1, 8, true)),
+                     value));
+    CHECK(value == 0);
+  }
+
+  SECTION("shifts past the bit width") {
+    REQUIRE(evaluate(context,
+                     makeBinary(requite::Opcode::_BITWISE_SHIFT_LEFT,
+                                makeLiteral(context, 1, 8),
+                                makeLiteral(context, 7, 8)),
+                     value));
+    CHECK(value == -128);
+    CHECK_FALSE(evaluate(context,
+                         makeBinary(requite::Opcode::_BITWISE_SHIFT_LEFT,
+                                    makeLiteral(context, 1, 8),
+                                    makeLiteral(context, 8, 8)),
+                         value));
+    CHECK_FALSE(evaluate(context,
+                         makeBinary(requite::Opcode::_BITWISE_SHIFT_RIGHT,
+                                    makeLiteral(context, 1, 8),
+                                    makeLiteral(context, -1, 8)),
+                         value));
+  }
+
+  SECTION("division by zero") {
+    CHECK_FALSE(evaluate(context,
+                         makeBinary(requite::Opcode::_DIVIDE,
+                                    makeLiteral(context, 1, 32),
+                                    makeLiteral(context, 0, 32)),
+                         value));
+    CHECK_FALSE(evaluate(context,
+                         makeBinary(requite::Opcode::_MODULUS,
+                                    makeLiteral(context, 1, 32),
+                                    makeLiteral(context, 0, 32)),
+                         value));
+  }
+
+  SECTION("signed division overflow") {
+    CHECK_FALSE(evaluate(context,
+                         makeBinary(requite::Opcode::_DIVIDE,
+                                    makeLiteral(context, -128, 8),
+                                    makeLiteral(context, -1, 8)),
+                         value));
+    CHECK_FALSE(evaluate(context,
+                         makeBinary(requite::Opcode::_MODULUS,
+                                    makeLiteral(context, -128, 8),
+                                    makeLiteral(context, -1, 8)),
+                         value));
+    REQUIRE(evaluate(context,
+                     makeBinary(requite::Opcode::_DIVIDE,
+                                makeLiteral(context, 128, 8, true),
+                                makeLiteral(context, 255, 8, true)),
+                     value));
+    CHECK(value == 0);
+  }
+
+  SECTION("mixed widths") {
+    CHECK_FALSE(evaluate(context,
+                         makeBinary(requite::Opcode::_ADD,
+                                    makeLiteral(context, 1, 8),
+                                    makeLiteral(context, 1, 16)),
+                         value));
+    CHECK_FALSE(evaluate(context,
+                         makeBinary(requite::Opcode::_ADD,
+                                    makeLiteral(context, 1, 8),
+                                    makeLiteral(context, 1, 8, true)),
+                         value));
+    CHECK_FALSE(evaluate(context,
+                         makeBinary(requite::Opcode::_LESS,
+                                    makeLiteral(context, 1, 8),
+                                    makeLiteral(context, 2, 16)),
+                         value));
+  }
+
+  SECTION("comparisons") {
+    requite::Expression &ascending =
+        makeBinary(requite::Opcode::_LESS, makeLiteral(context, 1, 32),
+                   makeLiteral(context, 2, 32));
+    ascending.getBranch().getNext().setNext(makeLiteral(context, 3, 32));
+    REQUIRE(evaluate(context, ascending, value));
+    CHECK(value.getBitWidth() == 1);
+    CHECK(value == 1);
+    requite::Expression &unordered =
+        makeBinary(requite::Opcode::_LESS, makeLiteral(context, 1, 32),
+                   makeLiteral(context, 3, 32));
+    unordered.getBranch().getNext().setNext(makeLiteral(context, 2, 32));
+    REQUIRE(evaluate(context, unordered, value));
+    CHECK(value == 0);
+    requite::Expression &repeated =
+        makeBinary(requite::Opcode::_NOT_EQUAL, makeLiteral(context, 1, 32),
+                   makeLiteral(context, 2, 32));
+    repeated.getBranch().getNext().setNext(makeLiteral(context, 1, 32));
+    REQUIRE(evaluate(context, repeated, value));
+    CHECK(value == 0);
+    REQUIRE(evaluate(context,
+                     makeBinary(requite::Opcode::_EQUAL,
+                                makeLiteral(context, 4, 32),
+                                makeLiteral(context, 4, 32)),
+                     value));
+    CHECK(value == 1);
+  }
+}
+
+TEST_CASE("requite::Context::foldConstantValue") {
+  requite::Context context(std::string("requite"));
+  requite::Scope scope;
+  requite::Expression &literal = makeLiteral(context, 0, 32);
+  const requite::TypeHandle i32 = literal.getResolvedType();
+  requite::Expression::deleteExpression(literal);
+
+  SECTION("constant values become literals") {
+    requite::Expression &add =
+        makeBinary(requite::Opcode::_ADD, makeLiteral(context, 2, 32),
+                   makeLiteral(context, 3, 32));
+    add.setResolvedType(i32);
+    context.foldConstantValue(scope, add);
+    CHECK(add.getOpcode() == requite::Opcode::__INTEGER_LITERAL);
+    CHECK_FALSE(add.getHasBranch());
+    CHECK(add.getInteger() == 5);
+    CHECK(add.getInteger().getBitWidth() == 32);
+    requite::Expression::deleteExpression(add);
+  }
+
+  SECTION("constant operands of other values are folded") {
+    requite::Expression &multiply =
+        makeBinary(requite::Opcode::_MULTIPLY, makeLiteral(context, 2, 32),
+                   makeLiteral(context, 3, 32));
+    multiply.setResolvedType(i32);
+    requite::Expression &identifier = requite::Expression::makeIdentifier("x");
+    identifier.setResolvedType(i32);
+    requite::Expression &add =
+        makeBinary(requite::Opcode::_ADD, identifier, multiply);
+    add.setResolvedType(i32);
+    context.foldConstantValue(scope, add);
+    CHECK(add.getOpcode() == requite::Opcode::_ADD);
+    CHECK(&add.getBranch() == &identifier);
+    CHECK(multiply.getOpcode() == requite::Opcode::__INTEGER_LITERAL);
+    CHECK(multiply.getInteger() == 6);
+    requite::Expression::deleteExpression(add);
+  }
+
+  SECTION("untyped values are left alone") {
+    requite::Expression &add =
+        makeBinary(requite::Opcode::_ADD, makeLiteral(context, 2, 32),
+                   makeLiteral(context, 3, 32));
+    context.foldConstantValue(scope, add);
+    CHECK(add.getOpcode() == requite::Opcode::_ADD);
+    requite::Expression::deleteExpression(add);
+  }
+}
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/expression.hpp>
+
+TEST_CASE("requite::Expression branches") {
+  requite::Expression &add =
+      requite::Expression::makeOperation(requite::Opcode::_ADD);
+  requite::Expression &a = requite::Expression::makeIdentifier("a");
+  requite::Expression &b = requite::Expression::makeIdentifier("b");
+  requite::Expression &c = requite::Expression::makeIdentifier("c");
+  add.setBranch(a);
+  a.setNext(b);
+  b.setNext(c);
+  const requite::Expression &const_add = add;
+
+  CHECK(add.getBranchCount() == 3);
+  CHECK(a.getNextCount() == 2);
+  CHECK(&add.getBranch(0) == &a);
+  CHECK(&add.getBranch(2) == &c);
+  CHECK(&const_add.getBranch(1) == &b);
+  CHECK(&a.getNext(0) == &b);
+  CHECK(&a.getNext(1) == &c);
+  CHECK(&add.getLastBranch() == &c);
+  CHECK(&const_add.getLastBranch() == &c);
+  CHECK(&a.getLastNext() == &c);
+  CHECK(c.getBranchCount() == 0);
+
+  requite::Expression::deleteExpression(add);
+}
@@ -4,7 +4,11 @@
 
 #include "catch2_ext.hpp"
 #include <cstdint>
+#include <llvm/ADT/APFloat.h>
+#include <llvm/ADT/APSInt.h>
+#include <random>
 #include <requite/numeric.hpp>
+#include <string>
 
 TEST_CASE("requite::getNumericValue(llvm::StringRef)") {
   SECTION("unsigned integrals") {
@@ -162,4 +166,138 @@ TEST_CASE("requite::getNumericValue(llvm::StringRef)") {
           requite::NumericResult::OK);
     CHECK(int64_value == 0);
   }
-}
\ No newline at end of file
+
+  SECTION("arbitrary width integers") {
+    llvm::APSInt value;
+    CHECK(requite::getNumericValue<llvm::APSInt>("0", value) ==
+          requite::NumericResult::OK);
+    CHECK(value == 0);
+    CHECK(requite::getNumericValue<llvm::APSInt>("1_000_000", value) ==
+          requite::NumericResult::OK);
+    CHECK(value == 1000000);
+    CHECK(requite::getNumericValue<llvm::APSInt>("16xFFFFFFFFFFFFFFFF", value) ==
+          requite::NumericResult::OK);
+    CHECK(value.getBitWidth() == 64);
+    CHECK(value.isMaxValue());
+    CHECK(requite::getNumericValue<llvm::APSInt>(
+              "340282366920938463463374607431768211455", value) ==
+          requite::NumericResult::OK);
+    CHECK(value.getBitWidth() == 128);
+    CHECK(value.isMaxValue());
+    CHECK(requite::getNumericValue<llvm::APSInt>(
+              "2x1_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_"
+              "0000_0000_0000_0000_0000",
+              value) == requite::NumericResult::OK);
+    CHECK(value.getBitWidth() == 65);
+    CHECK(value.countTrailingZeros() == 64);
+    CHECK(requite::getNumericValue<llvm::APSInt>("64x0", value) ==
+          requite::NumericResult::OK);
+    CHECK(value == 0);
+    CHECK(requite::getNumericValue<llvm::APSInt>("1.0", value) ==
+          requite::NumericResult::ERROR_INTEGER_WITH_DECIMAL_POINT);
+    CHECK(requite::getNumericValue<llvm::APSInt>("2x2", value) ==
+          requite::NumericResult::ERROR_INVALID_DIGIT);
+    CHECK(requite::getNumericValue<llvm::APSInt>("0x1", value) ==
+          requite::NumericResult::ERROR_ZERO_BASE);
+  }
+
+  SECTION("fitted integers") {
+    llvm::APSInt literal;
+    llvm::APSInt fitted;
+    REQUIRE(requite::getNumericValue<llvm::APSInt>("127", literal) ==
+            requite::NumericResult::OK);
+    CHECK(requite::getFittedInteger(literal, 8, false, fitted));
+    CHECK(fitted.getBitWidth() == 8);
+    CHECK(fitted.isSigned());
+    CHECK(fitted == 127);
+    REQUIRE(requite::getNumericValue<llvm::APSInt>("128", literal) ==
+            requite::NumericResult::OK);
+    CHECK_FALSE(requite::getFittedInteger(literal, 8, false, fitted));
+    CHECK(requite::getFittedInteger(literal, 8, true, fitted));
+    CHECK(fitted == 128);
+    CHECK_FALSE(requite::getFittedInteger(llvm::APSInt::get(-1), 32, true,
+                                          fitted));
+    CHECK(requite::getFittedInteger(llvm::APSInt::get(-1), 8, false, fitted));
+    CHECK(fitted.getBitWidth() == 8);
+    CHECK(fitted.isAllOnes());
+  }
+}
+
+TEST_CASE("requite::getNumericValue(llvm::StringRef, llvm::APFloat&)") {
+  const requite::FloatSemantics semantics_list[] = {
+      requite::FloatSemantics::BINARY_HALF,
+      requite::FloatSemantics::BINARY_SINGLE,
+      requite::FloatSemantics::BINARY_DOUBLE,
+      requite::FloatSemantics::BINARY_QUAD};
+
+  SECTION("rounding") {
+    // ties that round to even in each direction, the largest values, and
+    // the smallest subnormals
+    const char *texts[] = {"0.0",
+                           "0.1",
+                           "2049.0",
+                           "2051.0",
+                           "65519.0",
+                           "65520.0",
+                           "16777217.0",
+                           "16777219.0",
+                           "9007199254740993.0",
+                           "9007199254740995.0",
+                           "0.0000000298023223876953125",
+                           "0.000000000000000000000000000000000000000000001401298",
+                           "123456789012345678901234567890.123456789"};
+    for (const requite::FloatSemantics semantics : semantics_list) {
+      for (const char *text : texts) {
+        llvm::APFloat value(0.0);
+        REQUIRE(requite::getNumericValue(text, value, semantics) ==
+                requite::NumericResult::OK);
+        const llvm::APFloat expected(requite::getLlvmSemantics(semantics),
+                                     text);
+        CHECK(value.bitwiseIsEqual(expected));
+      }
+    }
+  }
+
+  SECTION("random literals match llvm::APFloat") {
+    std::mt19937_64 generator(0x5EED);
+    for (unsigned test_i = 0; test_i < 20000; ++test_i) {
+      std::string text;
+      const unsigned digit_count = 1 + generator() % 24;
+      const unsigned decimal_i = generator() % (digit_count + 1);
+      for (unsigned digit_i = 0; digit_i < digit_count; ++digit_i) {
+        if (digit_i == decimal_i) {
+          text += '.';
+        }
+        text += static_cast<char>('0' + generator() % 10);
+      }
+      if (decimal_i == digit_count) {
+        text += ".0";
+      }
+      if (generator() % 4 == 0) {
+        text.insert(0, "0." + std::string(generator() % 48, '0'));
+        text.erase(text.find('.', 2), 1);
+      }
+      const requite::FloatSemantics semantics =
+          semantics_list[generator() % std::size(semantics_list)];
+      llvm::APFloat value(0.0);
+      REQUIRE(requite::getNumericValue(text, value, semantics) ==
+              requite::NumericResult::OK);
+      const llvm::APFloat expected(requite::getLlvmSemantics(semantics), text);
+      INFO(text);
+      CHECK(value.bitwiseIsEqual(expected));
+    }
+  }
+
+  SECTION("errors") {
+    llvm::APFloat value(0.0);
+    CHECK(requite::getNumericValue(
+              "1.0.0", value, requite::FloatSemantics::BINARY_DOUBLE) ==
+          requite::NumericResult::ERROR_MULTIPLE_DECIMAL_POINT);
+    CHECK(requite::getNumericValue(
+              "1.a", value, requite::FloatSemantics::BINARY_DOUBLE) ==
+          requite::NumericResult::ERROR_INVALID_DIGIT);
+    CHECK(requite::getNumericValue(".", value,
+                                   requite::FloatSemantics::BINARY_DOUBLE) ==
+          requite::NumericResult::ERROR_NO_DIGITS);
+  }
+}
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+#include <requite/pool.hpp>
+
+#include <vector>
+
+struct PoolTestValue final {
+  std::vector<int> *_destroyed_ptr = nullptr;
+  int _value = 0;
+
+  PoolTestValue(std::vector<int> &destroyed, int value)
+      : _destroyed_ptr(&destroyed), _value(value) {}
+  PoolTestValue(const PoolTestValue &) = delete;
+  PoolTestValue(PoolTestValue &&) = delete;
+  ~PoolTestValue() { this->_destroyed_ptr->push_back(this->_value); }
+};
+
+TEST_CASE("requite::Pool") {
+  SECTION("addresses are stable across slabs") {
+    std::vector<int> destroyed;
+    requite::Pool<PoolTestValue, 4> pool;
+    std::vector<PoolTestValue *> value_ptrs;
+    for (int i = 0; i < 10; ++i) {
+      value_ptrs.push_back(&pool.make(destroyed, i));
+    }
+    CHECK(pool.getSize() == 10);
+    for (unsigned i = 0; i < 10; ++i) {
+      CHECK(&pool.get(i) == value_ptrs[i]);
+      CHECK(pool.get(i)._value == static_cast<int>(i));
+    }
+  }
+  SECTION("iteration follows creation order") {
+    std::vector<int> destroyed;
+    requite::Pool<PoolTestValue, 4> pool;
+    CHECK(pool.getIsEmpty());
+    CHECK(pool.begin() == pool.end());
+    for (int i = 0; i < 6; ++i) {
+      static_cast<void>(pool.make(destroyed, i));
+    }
+    int expected = 0;
+    for (PoolTestValue &value : pool) {
+      CHECK(value._value == expected);
+      ++expected;
+    }
+    CHECK(expected == 6);
+  }
+  SECTION("destruction is newest first") {
+    std::vector<int> destroyed;
+    {
+      requite::Pool<PoolTestValue, 4> pool;
+      for (int i = 0; i < 5; ++i) {
+        static_cast<void>(pool.make(destroyed, i));
+      }
+    }
+    CHECK(destroyed == std::vector<int>{4, 3, 2, 1, 0});
+  }
+}
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/context.hpp>
+#include <requite/diagnostics.hpp>
+#include <requite/expression.hpp>
+#include <requite/opcode.hpp>
+#include <requite/scope.hpp>
+#include <requite/symbol.hpp>
+#include <requite/type_interner.hpp>
+
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/SourceMgr.h>
+
+#include <string>
+#include <vector>
+
+static requite::TypeHandle makeIntegerType(requite::Context &context,
+                                           unsigned depth) {
+  requite::Symbol type;
+  type.getRoot().setType(requite::RootSymbolType::SIGNED_INTEGER);
+  type.getRoot().setDepth(depth);
+  return context.internType(type);
+}
+
+// Literals are given their type up front so that inference reads it from the
+// memo instead of asking the target for the address depth.
+static requite::Expression &makeTypedLiteral(requite::TypeHandle type) {
+  requite::Expression &literal = requite::Expression::makeInteger();
+  literal.setResolvedType(type);
+  return literal;
+}
+
+TEST_CASE("requite::Context::inferenceTypeOfValue") {
+  static constexpr llvm::StringRef SOURCE_TEXT = "(+ 1 2)";
+  requite::Context context(std::string("requite"));
+  requite::Scope scope;
+  const requite::TypeHandle i32 = makeIntegerType(context, 32);
+  const requite::TypeHandle i16 = makeIntegerType(context, 16);
+
+  SECTION("results are memoized on the expression") {
+    requite::Expression &add =
+        requite::Expression::makeOperation(requite::Opcode::_ADD);
+    requite::Expression &lhs = makeTypedLiteral(i32);
+    add.setBranch(lhs);
+    lhs.setNext(makeTypedLiteral(i32));
+    CHECK_FALSE(add.getHasResolvedType());
+    requite::TypeHandle type;
+    REQUIRE(context.inferenceTypeOfValue(type, scope, add));
+    CHECK(type == i32);
+    REQUIRE(add.getHasResolvedType());
+    CHECK(add.getResolvedType() == i32);
+    requite::TypeHandle again;
+    REQUIRE(context.inferenceTypeOfValue(again, scope, add));
+    CHECK(again == type);
+    requite::Expression::deleteExpression(add);
+  }
+
+  SECTION("operands of another type are reported") {
+    requite::Expression &add =
+        requite::Expression::makeOperation(requite::Opcode::_ADD);
+    requite::Expression &lhs = makeTypedLiteral(i32);
+    requite::Expression &rhs = makeTypedLiteral(i16);
+    rhs._source_text_ptr = SOURCE_TEXT.data() + 5;
+    rhs._source_text_length = 1;
+    add.setBranch(lhs);
+    lhs.setNext(rhs);
+    requite::TypeHandle type;
+    CHECK_FALSE(context.inferenceTypeOfValue(type, scope, add));
+    CHECK_FALSE(add.getHasResolvedType());
+    llvm::SourceMgr source_mgr;
+    std::vector<requite::Diagnostic> diagnostics;
+    context.getDiagnostics().gather(diagnostics, source_mgr);
+    REQUIRE(diagnostics.size() == 1);
+    CHECK(diagnostics[0].getType() == requite::LogType::ERROR);
+    CHECK(diagnostics[0].getLocation().getPointer() == SOURCE_TEXT.data() + 5);
+    CHECK(diagnostics[0].getMessage() ==
+          "operand type does not match first operand type");
+    requite::Expression::deleteExpression(add);
+  }
+}
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/alias.hpp>
+#include <requite/ordered_variable.hpp>
+#include <requite/scope.hpp>
+#include <requite/symbol.hpp>
+#include <requite/symbol_map.hpp>
+
+TEST_CASE("requite::Scope::lookupVisibleTypeSymbol") {
+  requite::Scope outer;
+  requite::Scope inner;
+  inner.setContaining(outer);
+  requite::Alias alias;
+  alias.setName("a");
+  outer.addInternalSymbol(alias);
+
+  SECTION("bindings that are not types are skipped") {
+    requite::OrderedVariable variable;
+    variable.setName("a");
+    inner.addInternalSymbol(variable);
+    requite::RootSymbol root =
+        inner.lookupVisibleTypeSymbol(requite::HashedName("a"));
+    REQUIRE(root.getIsAlias());
+    CHECK(&root.getAlias() == &alias);
+  }
+
+  SECTION("new bindings in containing scopes are seen") {
+    CHECK(inner.lookupVisibleTypeSymbol(requite::HashedName("b")).getIsNone());
+    requite::Alias other;
+    other.setName("b");
+    outer.addInternalSymbol(other);
+    requite::RootSymbol root =
+        inner.lookupVisibleTypeSymbol(requite::HashedName("b"));
+    REQUIRE(root.getIsAlias());
+    CHECK(&root.getAlias() == &other);
+  }
+
+  SECTION("cache hits do not change the generation") {
+    CHECK(inner.lookupVisibleTypeSymbol(requite::HashedName("a")).getIsAlias());
+    const std::uint64_t generation = requite::Scope::getSymbolGeneration();
+    CHECK(inner.lookupVisibleTypeSymbol(requite::HashedName("a")).getIsAlias());
+    CHECK(requite::Scope::getSymbolGeneration() == generation);
+    requite::Alias other;
+    other.setName("c");
+    outer.addInternalSymbol(other);
+    CHECK(requite::Scope::getSymbolGeneration() != generation);
+  }
+}
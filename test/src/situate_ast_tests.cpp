@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/context.hpp>
+#include <requite/expression.hpp>
+#include <requite/module.hpp>
+#include <requite/opcode.hpp>
+#include <requite/token.hpp>
+
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+static std::string makeSourceText(unsigned statement_count) {
+  std::string text;
+  llvm::raw_string_ostream text_stream(text);
+  for (unsigned statement_i = 0; statement_i < statement_count;
+       ++statement_i) {
+    text_stream << "[entry_point\n"
+                   "    [exit "
+                << statement_i << "]\n]\n";
+  }
+  text_stream.flush();
+  return text;
+}
+
+// the source is added to the context so that locations of the parsed
+// expressions can be looked up like those of a loaded file.
+static void parseModule(requite::Context &context, requite::Module &module,
+                        llvm::StringRef text) {
+  std::unique_ptr<llvm::MemoryBuffer> buffer_uptr =
+      llvm::MemoryBuffer::getMemBufferCopy(text, "situate.rq");
+  requite::File &file = module.getFile();
+  file._path = "situate.rq";
+  file._buffer_ref = buffer_uptr->getMemBufferRef();
+  file._buffer_i = context._source_mgr.AddNewSourceBuffer(
+      std::move(buffer_uptr), llvm::SMLoc());
+  std::vector<requite::Token> tokens = {};
+  REQUIRE(context.tokenizeTokens(module, tokens));
+  REQUIRE(context.parseAst(module, tokens));
+}
+
+TEST_CASE("requite::Context::situateAst") {
+  requite::Context context(std::string("requite"));
+  context.createOpcodeTable();
+  requite::Module module;
+  parseModule(context, module, makeSourceText(2));
+  REQUIRE(context.situateAst(module));
+  REQUIRE(module.getHasExpression());
+  const requite::Expression &root = module.getExpression();
+  CHECK(root.getOpcode() == requite::Opcode::MODULE);
+  CHECK(root.getBranchCount() == 3);
+  requite::Expression::deleteExpression(module.popExpression());
+}
+
+TEST_CASE("requite::Context::situateAst statements", "[.][benchmark]") {
+  static const std::string SOURCE_TEXT = makeSourceText(1000);
+  requite::Context context(std::string("requite"));
+  context.createOpcodeTable();
+  BENCHMARK_ADVANCED("situate 1000 statements")
+  (Catch::Benchmark::Chronometer meter) {
+    std::vector<std::unique_ptr<requite::Module>> module_uptrs = {};
+    module_uptrs.reserve(meter.runs());
+    for (int run_i = 0; run_i < meter.runs(); ++run_i) {
+      parseModule(context, *module_uptrs.emplace_back(
+                               std::make_unique<requite::Module>()),
+                  SOURCE_TEXT);
+    }
+    meter.measure(
+        [&](int run_i) { return context.situateAst(*module_uptrs[run_i]); });
+  };
+}
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/source_line_table.hpp>
+
+#include <llvm/ADT/StringRef.h>
+
+TEST_CASE("requite::SourceLineTable") {
+  const llvm::StringRef text = "ab\ncd\n\nef";
+  requite::SourceLineTable table("test.rq", text);
+  CHECK(table.getLineCount() == 4);
+
+  SECTION("in order") {
+    const unsigned expected[][2] = {{1, 1}, {1, 2}, {1, 3}, {2, 1}, {2, 2},
+                                    {2, 3}, {3, 1}, {4, 1}, {4, 2}, {4, 3}};
+    for (unsigned offset = 0; offset <= text.size(); ++offset) {
+      const requite::SourceLocation location =
+          table.getLocation(text.data() + offset);
+      CHECK(location.file == "test.rq");
+      CHECK(location.line == expected[offset][0]);
+      CHECK(location.column == expected[offset][1]);
+    }
+  }
+
+  SECTION("out of order") {
+    CHECK(table.getLocation(text.data() + 8).line == 4);
+    CHECK(table.getLocation(text.data() + 1).line == 1);
+    CHECK(table.getLocation(text.data() + 6).line == 3);
+    CHECK(table.getLocation(text.data() + 4).column == 2);
+  }
+
+  SECTION("outside of the text") {
+    const llvm::StringRef other = "xyz";
+    CHECK_FALSE(table.getHasLocation(other.data()));
+  }
+}
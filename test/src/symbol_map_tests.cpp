@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+#include <requite/symbol.hpp>
+#include <requite/symbol_map.hpp>
+
+#include <string>
+
+static requite::RootSymbol makeIntegerSymbol(unsigned depth) {
+  requite::RootSymbol root;
+  root.setType(requite::RootSymbolType::SIGNED_INTEGER);
+  root.setDepth(depth);
+  return root;
+}
+
+TEST_CASE("requite::SymbolMap") {
+  SECTION("empty") {
+    requite::SymbolMap map;
+    CHECK(map.getIsEmpty());
+    CHECK(map.find(requite::HashedName("a")) == nullptr);
+    CHECK_FALSE(map.getHasName(requite::HashedName("a")));
+  }
+  SECTION("insert and find") {
+    requite::SymbolMap map;
+    CHECK(map.insert(requite::HashedName("a"), makeIntegerSymbol(8)));
+    CHECK(map.insert(requite::HashedName("b"), makeIntegerSymbol(16)));
+    CHECK_FALSE(map.insert(requite::HashedName("a"), makeIntegerSymbol(32)));
+    CHECK(map.getSize() == 2);
+    REQUIRE(map.find(requite::HashedName("a")) != nullptr);
+    CHECK(map.find(requite::HashedName("a"))->getDepth() == 8);
+    REQUIRE(map.find(requite::HashedName("b")) != nullptr);
+    CHECK(map.find(requite::HashedName("b"))->getDepth() == 16);
+    CHECK(map.find(requite::HashedName("c")) == nullptr);
+  }
+  SECTION("clear") {
+    requite::SymbolMap map;
+    CHECK(map.insert(requite::HashedName("a"), makeIntegerSymbol(8)));
+    map.clear();
+    CHECK(map.getIsEmpty());
+    CHECK(map.find(requite::HashedName("a")) == nullptr);
+    CHECK(map.insert(requite::HashedName("a"), makeIntegerSymbol(16)));
+    REQUIRE(map.find(requite::HashedName("a")) != nullptr);
+    CHECK(map.find(requite::HashedName("a"))->getDepth() == 16);
+  }
+  SECTION("growth keeps every entry in insertion order") {
+    requite::SymbolMap map;
+    for (unsigned i = 0; i < 1000; ++i) {
+      CHECK(map.insert(requite::HashedName(std::to_string(i)),
+                       makeIntegerSymbol(i + 1)));
+    }
+    CHECK(map.getSize() == 1000);
+    for (unsigned i = 0; i < 1000; ++i) {
+      const std::string name = std::to_string(i);
+      const requite::RootSymbol *root_ptr =
+          map.find(requite::HashedName(name));
+      REQUIRE(root_ptr != nullptr);
+      CHECK(root_ptr->getDepth() == i + 1);
+    }
+    unsigned i = 0;
+    for (const requite::SymbolMapEntry &entry : map) {
+      CHECK(entry.getName() == std::to_string(i));
+      ++i;
+    }
+  }
+}
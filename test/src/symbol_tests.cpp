@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+#include <requite/symbol.hpp>
+#include <requite/tuple.hpp>
+
+static bool getIsSubsInline(const requite::Symbol &symbol) {
+  const char *data_ptr =
+      reinterpret_cast<const char *>(symbol.getSubs().data());
+  const char *symbol_ptr = reinterpret_cast<const char *>(&symbol);
+  return data_ptr >= symbol_ptr && data_ptr < symbol_ptr + sizeof(symbol);
+}
+
+static requite::Symbol makeReferenceSymbol() {
+  requite::Symbol symbol;
+  symbol.getRoot().setType(requite::RootSymbolType::SIGNED_INTEGER);
+  symbol.getRoot().setDepth(32);
+  requite::SubSymbol &sub = symbol.makeSubSymbol();
+  sub.setType(requite::SubSymbolType::REFERENCE);
+  return symbol;
+}
+
+TEST_CASE("requite::Symbol::makeSubSymbol()") {
+  SECTION("short sub symbol chains are stored inline") {
+    requite::Symbol symbol = makeReferenceSymbol();
+    CHECK(symbol.getSubs().size() == 1);
+    CHECK(getIsSubsInline(symbol));
+    requite::SubSymbol &pointer = symbol.makeSubSymbol();
+    pointer.setType(requite::SubSymbolType::POINTER);
+    CHECK(symbol.getSubs().size() == requite::Symbol::INLINE_SUB_COUNT);
+    CHECK(getIsSubsInline(symbol));
+  }
+  SECTION("copies keep the chain") {
+    requite::Symbol symbol = makeReferenceSymbol();
+    requite::Symbol copy = symbol;
+    CHECK(copy == symbol);
+    CHECK(getIsSubsInline(copy));
+  }
+  SECTION("copies of structured roots still allocate their data") {
+    // Only the sub symbol chain is inline. A signature, tuple or anonymous
+    // object root owns its data, and a copy allocates its own.
+    requite::Symbol symbol;
+    symbol.getRoot().setType(requite::RootSymbolType::TUPLE);
+    symbol.getRoot().getTuple().getElementTypes().push_back(
+        makeReferenceSymbol());
+    symbol.makeSubSymbol().setType(requite::SubSymbolType::POINTER);
+    requite::Symbol copy = symbol;
+    CHECK(copy == symbol);
+    CHECK(getIsSubsInline(copy));
+    CHECK(&copy.getRoot().getTuple() != &symbol.getRoot().getTuple());
+  }
+}
+
+TEST_CASE("requite::Symbol sub symbol allocation", "[.][benchmark]") {
+  BENCHMARK("make reference symbol") { return makeReferenceSymbol(); };
+  BENCHMARK("copy reference symbol") {
+    static const requite::Symbol symbol = makeReferenceSymbol();
+    return requite::Symbol(symbol);
+  };
+}
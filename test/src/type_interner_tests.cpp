@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2025 Daniel Aimé Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_ext.hpp"
+
+#include <requite/symbol.hpp>
+#include <requite/tuple.hpp>
+#include <requite/type_interner.hpp>
+
+#include <vector>
+
+static requite::Symbol makeIntegerSymbol(
+    unsigned depth,
+    requite::RootSymbolType type = requite::RootSymbolType::SIGNED_INTEGER) {
+  requite::Symbol symbol;
+  symbol.getRoot().setType(type);
+  symbol.getRoot().setDepth(depth);
+  return symbol;
+}
+
+static requite::Symbol makeRootSymbol(requite::RootSymbolType type) {
+  requite::Symbol symbol;
+  symbol.getRoot().setType(type);
+  return symbol;
+}
+
+static requite::Symbol makeTupleSymbol(unsigned first_depth,
+                                       unsigned second_depth) {
+  requite::Symbol symbol = makeRootSymbol(requite::RootSymbolType::TUPLE);
+  std::vector<requite::Symbol> &elements =
+      symbol.getRoot().getTuple().getElementTypes();
+  elements.push_back(makeIntegerSymbol(first_depth));
+  elements.push_back(makeIntegerSymbol(second_depth));
+  return symbol;
+}
+
+TEST_CASE("requite::TypeInterner") {
+  requite::TypeInterner interner;
+
+  SECTION("equal types share a handle") {
+    const requite::TypeHandle first = interner.intern(makeIntegerSymbol(32));
+    const requite::TypeHandle second = interner.intern(makeIntegerSymbol(32));
+    CHECK(first == second);
+    CHECK(first.getSymbol() == makeIntegerSymbol(32));
+    CHECK(interner.getSize() == 1);
+  }
+
+  SECTION("distinct types have distinct handles") {
+    const requite::TypeHandle integer = interner.intern(makeIntegerSymbol(32));
+    const requite::TypeHandle narrow = interner.intern(makeIntegerSymbol(16));
+    requite::Symbol reference = makeIntegerSymbol(32);
+    reference.makeSubSymbol().setType(requite::SubSymbolType::REFERENCE);
+    const requite::TypeHandle referenced = interner.intern(reference);
+    requite::Symbol pointer = makeIntegerSymbol(32);
+    pointer.makeSubSymbol().setType(requite::SubSymbolType::POINTER);
+    const requite::TypeHandle pointed = interner.intern(pointer);
+    CHECK(integer != narrow);
+    CHECK(integer != referenced);
+    CHECK(referenced != pointed);
+    CHECK(interner.getSize() == 4);
+  }
+
+  SECTION("many types") {
+    // Enough types that the table grows and probes past occupied slots.
+    std::vector<requite::TypeHandle> handles;
+    for (unsigned depth = 1; depth <= 2048; ++depth) {
+      handles.push_back(interner.intern(makeIntegerSymbol(depth)));
+    }
+    CHECK(interner.getSize() == 2048);
+    for (unsigned depth = 1; depth <= 2048; ++depth) {
+      const requite::TypeHandle handle =
+          interner.intern(makeIntegerSymbol(depth));
+      CHECK(handle == handles[depth - 1]);
+      CHECK(handle.getSymbol().getRoot().getDepth() == depth);
+    }
+    CHECK(interner.getSize() == 2048);
+  }
+
+  SECTION("lookups compare symbols by value") {
+    requite::Symbol lhs = makeIntegerSymbol(8);
+    requite::Symbol rhs =
+        makeIntegerSymbol(8, requite::RootSymbolType::UNSIGNED_INTEGER);
+    CHECK_FALSE(requite::InternedSymbolInfo::isEqual(lhs, &rhs));
+    CHECK(requite::InternedSymbolInfo::isEqual(lhs, &lhs));
+    CHECK_FALSE(requite::InternedSymbolInfo::isEqual(
+        lhs, requite::InternedSymbolInfo::getEmptyKey()));
+    CHECK_FALSE(requite::InternedSymbolInfo::isEqual(
+        lhs, requite::InternedSymbolInfo::getTombstoneKey()));
+  }
+
+  SECTION("types without a depth") {
+    const requite::TypeHandle boolean =
+        interner.intern(makeRootSymbol(requite::RootSymbolType::BOOLEAN));
+    const requite::TypeHandle real = interner.intern(
+        makeRootSymbol(requite::RootSymbolType::BINARY_DOUBLE_FLOAT));
+    const requite::TypeHandle tuple = interner.intern(makeTupleSymbol(8, 16));
+    CHECK(boolean ==
+          interner.intern(makeRootSymbol(requite::RootSymbolType::BOOLEAN)));
+    CHECK(real == interner.intern(makeRootSymbol(
+                      requite::RootSymbolType::BINARY_DOUBLE_FLOAT)));
+    CHECK(tuple == interner.intern(makeTupleSymbol(8, 16)));
+    CHECK(tuple != interner.intern(makeTupleSymbol(8, 32)));
+    CHECK(boolean != real);
+    CHECK(boolean != tuple);
+  }
+}
+
+TEST_CASE("requite::RootSymbol equality without a depth") {
+  CHECK(makeRootSymbol(requite::RootSymbolType::BOOLEAN) ==
+        makeRootSymbol(requite::RootSymbolType::BOOLEAN));
+  CHECK(makeRootSymbol(requite::RootSymbolType::BINARY_DOUBLE_FLOAT) ==
+        makeRootSymbol(requite::RootSymbolType::BINARY_DOUBLE_FLOAT));
+  CHECK(makeRootSymbol(requite::RootSymbolType::BOOLEAN) !=
+        makeRootSymbol(requite::RootSymbolType::BINARY_DOUBLE_FLOAT));
+  CHECK(makeTupleSymbol(8, 16) == makeTupleSymbol(8, 16));
+  CHECK(makeTupleSymbol(8, 16) != makeTupleSymbol(16, 8));
+  CHECK(makeRootSymbol(requite::RootSymbolType::BOOLEAN) !=
+        makeIntegerSymbol(8));
+}